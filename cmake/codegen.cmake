@@ -0,0 +1,72 @@
+##########################################################################################
+#                                                                                        #
+# OpenSpace Codegen                                                                      #
+#                                                                                        #
+# Copyright (c) 2021-2026                                                                #
+#                                                                                        #
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this   #
+# software and associated documentation files (the "Software"), to deal in the Software  #
+# without restriction, including without limitation the rights to use, copy, modify,     #
+# merge, publish, distribute, sublicense, and/or sell copies of the Software, and to     #
+# permit persons to whom the Software is furnished to do so, subject to the following    #
+# conditions:                                                                            #
+#                                                                                        #
+# The above copyright notice and this permission notice shall be included in all copies  #
+# or substantial portions of the Software.                                               #
+#                                                                                        #
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,    #
+# INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A          #
+# PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT     #
+# HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF   #
+# CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE   #
+# OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                          #
+##########################################################################################
+
+set(CODEGEN_CHECK_OUTPUTS_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/codegen_check_outputs.cmake")
+
+# Registers a build step that runs the codegen tool for each of the provided sources of
+# the `target`. Every source gets its own custom command that depends on the source file
+# and the codegen tool, so that the codegen only runs for sources that have changed since
+# the last build. The `_codegen.cpp` files are generated next to the sources and the
+# target is only compiled after all of them have been generated. Generated files that were
+# deleted since the last build are recreated even if their source has not changed.
+#
+# Usage:  codegen_add_sources(target source1 [source2 ...])
+function (codegen_add_sources target)
+  set(manifests "")
+  set(entries "")
+  foreach (source IN LISTS ARGN)
+    get_filename_component(source "${source}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+    file(RELATIVE_PATH name "${CMAKE_CURRENT_SOURCE_DIR}" "${source}")
+    string(MAKE_C_IDENTIFIER "${name}" name)
+
+    # The manifest is written on every run of the codegen and is the output of the
+    # command, as sources without any codegen markers don't produce a `_codegen.cpp` file
+    set(manifest "${CMAKE_CURRENT_BINARY_DIR}/codegen/${target}/${name}.outputs")
+    add_custom_command(
+      OUTPUT "${manifest}"
+      COMMAND codegen-tool ARGS --outputs-manifest "${manifest}" "${source}"
+      DEPENDS codegen-tool "${source}"
+      COMMENT "Running codegen for ${source}"
+      VERBATIM
+    )
+    list(APPEND manifests "${manifest}")
+    list(APPEND entries "${manifest}" "${source}")
+  endforeach ()
+
+  # The custom target runs on every build and checks that all files listed in the
+  # manifests still exist, as the custom commands only run when a source has changed
+  set(check "${CMAKE_CURRENT_BINARY_DIR}/codegen/${target}/check_outputs.cmake")
+  file(GENERATE OUTPUT "${check}" CONTENT
+"set(codegen_tool \"$<TARGET_FILE:codegen-tool>\")
+set(codegen_entries \"${entries}\")
+include(\"${CODEGEN_CHECK_OUTPUTS_SCRIPT}\")
+"
+  )
+  add_custom_target(${target}-codegen
+    COMMAND "${CMAKE_COMMAND}" -P "${check}"
+    DEPENDS ${manifests}
+    VERBATIM
+  )
+  add_dependencies(${target} ${target}-codegen)
+endfunction ()
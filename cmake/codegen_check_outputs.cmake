@@ -0,0 +1,57 @@
+##########################################################################################
+#                                                                                        #
+# OpenSpace Codegen                                                                      #
+#                                                                                        #
+# Copyright (c) 2021-2026                                                                #
+#                                                                                        #
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this   #
+# software and associated documentation files (the "Software"), to deal in the Software  #
+# without restriction, including without limitation the rights to use, copy, modify,     #
+# merge, publish, distribute, sublicense, and/or sell copies of the Software, and to     #
+# permit persons to whom the Software is furnished to do so, subject to the following    #
+# conditions:                                                                            #
+#                                                                                        #
+# The above copyright notice and this permission notice shall be included in all copies  #
+# or substantial portions of the Software.                                               #
+#                                                                                        #
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,    #
+# INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A          #
+# PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT     #
+# HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF   #
+# CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE   #
+# OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                          #
+##########################################################################################
+
+# Runs the codegen again for every source whose manifest lists a generated file that does
+# not exist anymore. The manifest is only updated when the source changes, so without this
+# check a `_codegen.cpp` file that was deleted after the last build would not be recreated.
+#
+# This script is run with `cmake -P` by the codegen target created by
+# `codegen_add_sources` and expects the variables `codegen_tool`, the path to the codegen
+# executable, and `codegen_entries`, a list of alternating manifest and source paths.
+list(LENGTH codegen_entries n_entries)
+if (n_entries EQUAL 0)
+  return()
+endif ()
+
+math(EXPR last "${n_entries} - 1")
+foreach (i RANGE 0 ${last} 2)
+  math(EXPR j "${i} + 1")
+  list(GET codegen_entries ${i} manifest)
+  list(GET codegen_entries ${j} source)
+
+  file(STRINGS "${manifest}" outputs)
+  foreach (output IN LISTS outputs)
+    if (NOT EXISTS "${output}")
+      message(STATUS "Running codegen for ${source} as ${output} is missing")
+      execute_process(
+        COMMAND "${codegen_tool}" --outputs-manifest "${manifest}" "${source}"
+        RESULT_VARIABLE result
+      )
+      if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Running codegen for ${source} failed")
+      endif ()
+      break()
+    endif ()
+  endforeach ()
+endforeach ()
@@ -0,0 +1,61 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include "arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace {
+    // The default size of each block that is requested from the heap. Allocations that
+    // are larger than this get a block of their own
+    constexpr size_t BlockSize = 16 * 1024;
+} // namespace
+
+Arena::~Arena() {
+    for (auto it = destructors.rbegin(); it != destructors.rend(); it++) {
+        it->function(it->object);
+    }
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    const uintptr_t address = reinterpret_cast<uintptr_t>(cursor);
+    const uintptr_t aligned = (address + alignment - 1) & ~(alignment - 1);
+    const size_t padding = aligned - address;
+
+    if (!cursor || padding + size > static_cast<size_t>(end - cursor)) {
+        const size_t blockSize = std::max(BlockSize, size + alignment);
+        blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(blockSize));
+        cursor = blocks.back().get();
+        end = cursor + blockSize;
+        return allocate(size, alignment);
+    }
+
+    std::byte* result = cursor + padding;
+    cursor = result + size;
+    return result;
+}
@@ -0,0 +1,86 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CODEGEN___ARENA___H__
+#define __OPENSPACE_CODEGEN___ARENA___H__
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * A bump allocator that owns all objects of the parsed type model of a single file. The
+ * objects are placed into large memory blocks that are requested from the heap in one go
+ * and all of the objects are destroyed together when the Arena itself is destroyed. The
+ * pointers returned by #create stay valid for the lifetime of the Arena.
+ */
+struct Arena {
+    Arena() = default;
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * Creates a new object of type \p T in the arena by forwarding the \p args to its
+     * constructor. The object is destroyed when the Arena is destroyed.
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args);
+
+    /**
+     * Returns a pointer to \p size bytes of uninitialized memory that is aligned to
+     * \p alignment, which has to be a power of two.
+     */
+    void* allocate(size_t size, size_t alignment);
+
+    // Implementation details. `cursor` and `end` delimit the unused part of the last
+    // block. The destructors are called in reverse order of creation
+    struct Destructor {
+        void (*function)(void*) = nullptr;
+        void* object = nullptr;
+    };
+    std::vector<std::unique_ptr<std::byte[]>> blocks;
+    std::byte* cursor = nullptr;
+    std::byte* end = nullptr;
+    std::vector<Destructor> destructors;
+};
+
+template <typename T, typename... Args>
+T* Arena::create(Args&&... args) {
+    void* memory = allocate(sizeof(T), alignof(T));
+    T* object = new (memory) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        destructors.push_back({
+            [](void* obj) { static_cast<T*>(obj)->~T(); },
+            object
+        });
+    }
+    return object;
+}
+
+#endif // __OPENSPACE_CODEGEN___ARENA___H__
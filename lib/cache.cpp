@@ -0,0 +1,152 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include "cache.h"
+
+#include <charconv>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace {
+    // Increase this number whenever the layout of the cache file changes
+    constexpr int CacheFormatVersion = 1;
+
+#ifndef CODEGEN_SOURCE_HASH
+#error "CODEGEN_SOURCE_HASH has to be defined by the build system"
+#endif // CODEGEN_SOURCE_HASH
+
+    // A hash of all sources of the library, which changes whenever anything changes that
+    // might affect the generated files. Cached results of a different version are ignored
+    constexpr uint64_t GeneratorVersion = CODEGEN_SOURCE_HASH;
+
+    template <typename T>
+    bool extractNumber(std::string_view& line, T& value) {
+        const char* end = line.data() + line.size();
+        auto [ptr, ec] = std::from_chars(line.data(), end, value);
+        if (ec != std::errc() || ptr == end || *ptr != ' ') {
+            return false;
+        }
+        line.remove_prefix(ptr - line.data() + 1);
+        return true;
+    }
+} // namespace
+
+void loadCache(const std::filesystem::path& path, Cache& cache) {
+    std::ifstream file = std::ifstream(path);
+    if (!file.good()) {
+        return;
+    }
+
+    std::string line;
+    std::getline(file, line);
+    if (line != std::format("codegen-cache {} {}", CacheFormatVersion, GeneratorVersion)) {
+        // The cache was written by a different version of the tool, so we can't trust
+        // any of the entries
+        return;
+    }
+
+    std::lock_guard lock(cache.mutex);
+    while (std::getline(file, line)) {
+        // Each line is:  <size> <modification time> <content hash> <has output> <path>
+        std::string_view l = line;
+        Cache::Entry entry;
+        int hasOutput = 0;
+        const bool success =
+            extractNumber(l, entry.size) && extractNumber(l, entry.modificationTime) &&
+            extractNumber(l, entry.contentHash) && extractNumber(l, hasOutput);
+        if (!success || l.empty()) {
+            // Something is wrong with the file, so it is safest to ignore all of it
+            cache.entries.clear();
+            return;
+        }
+        entry.hasOutput = hasOutput != 0;
+        cache.entries[std::string(l)] = entry;
+    }
+}
+
+void saveCache(const std::filesystem::path& path, const Cache& cache) {
+    std::filesystem::path tmp = path;
+    tmp += ".tmp";
+
+    {
+        std::ofstream file = std::ofstream(tmp, std::ofstream::trunc);
+        file << std::format(
+            "codegen-cache {} {}\n", CacheFormatVersion, GeneratorVersion
+        );
+
+        std::lock_guard lock(cache.mutex);
+        for (const auto& [source, e] : cache.entries) {
+            file << std::format(
+                "{} {} {} {} {}\n",
+                e.size, e.modificationTime, e.contentHash, e.hasOutput ? 1 : 0, source
+            );
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp, ec);
+    }
+}
+
+std::optional<Cache::Entry> cacheEntry(const Cache& cache,
+                                       const std::filesystem::path& source)
+{
+    std::lock_guard lock(cache.mutex);
+    const auto it = cache.entries.find(source.string());
+    if (it == cache.entries.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void updateCacheEntry(Cache& cache, const std::filesystem::path& source,
+                      Cache::Entry entry)
+{
+    std::lock_guard lock(cache.mutex);
+    cache.entries[source.string()] = entry;
+}
+
+void removeCacheEntry(Cache& cache, const std::filesystem::path& source) {
+    std::lock_guard lock(cache.mutex);
+    cache.entries.erase(source.string());
+}
+
+uint64_t hashContent(std::string_view data, uint64_t seed) {
+    constexpr uint64_t Prime = 1099511628211ULL;
+
+    uint64_t hash = seed;
+    for (const char c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= Prime;
+    }
+    return hash;
+}
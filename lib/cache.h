@@ -0,0 +1,85 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CODEGEN___CACHE___H__
+#define __OPENSPACE_CODEGEN___CACHE___H__
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * The persistent cache that stores information about previously handled source files so
+ * that unchanged files do not have to be parsed again. Each entry is keyed by the path
+ * of the source file. The cache as a whole is tagged with a hash of the sources of the
+ * library so that a version of codegen that generates different files ignores the
+ * cached values.
+ *
+ * All of the functions operating on a Cache can be called from multiple threads.
+ */
+struct Cache {
+    struct Entry {
+        uintmax_t size = 0;
+        long long modificationTime = 0;
+        uint64_t contentHash = 0;
+        // If this is true, a `_codegen.cpp` file was generated for this source file
+        bool hasOutput = false;
+    };
+
+    std::unordered_map<std::string, Entry> entries;
+    mutable std::mutex mutex;
+};
+
+/**
+ * Loads the entries from the cache file at \p path into the \p cache. If the file does
+ * not exist, is malformed, or was written by a version of the tool that was built from
+ * different sources, the cache is left empty.
+ */
+void loadCache(const std::filesystem::path& path, Cache& cache);
+
+/**
+ * Writes the \p cache to the file at \p path. The file is first written to a temporary
+ * file and then moved into place so that an interrupted run never leaves a half-written
+ * cache file behind.
+ */
+void saveCache(const std::filesystem::path& path, const Cache& cache);
+
+[[nodiscard]] std::optional<Cache::Entry> cacheEntry(const Cache& cache,
+    const std::filesystem::path& source);
+void updateCacheEntry(Cache& cache, const std::filesystem::path& source,
+    Cache::Entry entry);
+void removeCacheEntry(Cache& cache, const std::filesystem::path& source);
+
+/**
+ * Computes the 64-bit FNV-1a hash of the provided \p data. Passing the result of a
+ * previous call as the \p seed combines multiple hashes.
+ */
+[[nodiscard]] uint64_t hashContent(std::string_view data,
+    uint64_t seed = 14695981039346656037ULL);
+
+#endif // __OPENSPACE_CODEGEN___CACHE___H__
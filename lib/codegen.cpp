@@ -24,13 +24,18 @@
 
 #include "codegen.h"
 
+#include "cache.h"
 #include "keywords.h"
+#include "mappedfile.h"
 #include "parsing.h"
+#include "profile.h"
 #include "settings.h"
 #include "snippets.h"
 #include "types.h"
+#include "util.h"
 #include "verifier.h"
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cctype>
 #include <filesystem>
@@ -38,9 +43,14 @@
 #include <fstream>
 #include <iostream>
 #include <iterator>
+#include <optional>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 using namespace std::literals;
@@ -157,18 +167,27 @@ namespace {
             res.insert(res.end(), r.begin(), r.end());
         }
 
-        // Remove duplicates
-        for (int i = 0; i < static_cast<int>(res.size()); i++) {
-            for (int j = i + 1; j < static_cast<int>(res.size()); j++) {
-                if (*res[i] == *res[j]) {
-                    res.erase(res.begin() + j);
-                    i--;
-                    break;
-                }
+        // Remove duplicates, keeping the types in the order of their first occurrence
+        struct TypeHash {
+            size_t operator()(const VariableType* t) const { return structuralHash(*t); }
+        };
+        struct TypeEqual {
+            bool operator()(const VariableType* lhs, const VariableType* rhs) const {
+                return *lhs == *rhs;
+            }
+        };
+        std::unordered_set<const VariableType*, TypeHash, TypeEqual> seen;
+        seen.reserve(res.size());
+
+        std::vector<const VariableType*> unique;
+        unique.reserve(res.size());
+        for (const VariableType* t : res) {
+            if (seen.insert(t).second) {
+                unique.push_back(t);
             }
         }
 
-        return res;
+        return unique;
     }
 
     std::vector<Enum*> mappedEnums(const Struct& s) {
@@ -275,6 +294,13 @@ namespace {
         bool needsToStringFallback = false;
         bool needsFromStringFallback = false;
 
+        // The bake functions for vectors and arrays need std::to_chars for their keys
+        bool needsKeyFormatting = false;
+        // The serialization functions only exist if a struct asks for them
+        bool needsSerializeFunctions = false;
+        // The bakeMany functions only exist if a struct asks for them
+        bool needsBakeMany = false;
+
         bool needsAny() const {
             return needsArrayifyFallback || needsMappingFallback ||
                    needsBakeEnumFallback || needsToStringFallback ||
@@ -287,7 +313,7 @@ namespace {
         assert(currentStruct);
 
         if (type->tag == VariableType::Tag::BasicType) {
-            BasicType* bt = static_cast<BasicType*>(type);
+            const BasicType* bt = static_cast<const BasicType*>(type);
             const std::string v = verifierForType(bt->type, var.attributes);
             return "new " + v;
         }
@@ -349,7 +375,7 @@ namespace {
         else if (type->tag == VariableType::Tag::MapType) {
             MapType* mt = static_cast<MapType*>(type);
             if (mt->valueType->tag == VariableType::Tag::BasicType) {
-                BasicType* valueType = static_cast<BasicType*>(mt->valueType);
+                const BasicType* valueType = static_cast<const BasicType*>(mt->valueType);
                 std::string verifier = verifierForType(valueType->type, var.attributes);
                 return std::format(
                     "new TableVerifier({{{{\"*\",new {}}}}})", verifier
@@ -387,34 +413,35 @@ namespace {
         }
     }
 
-    std::string writeEnumDocumentation(Enum* e) {
-        std::string result = std::format(
+    void writeEnumDocumentation(std::string& result, Enum* e) {
+        std::format_to(
+            std::back_inserter(result),
             "    std::shared_ptr<StringInListVerifier> codegen_{} = std::make_shared<StringInListVerifier>(std::vector<std::string>{{",
             fqn(e, "_")
         );
 
         for (EnumElement* em : e->elements) {
             // If no key attribute is specified, we use the name instead
-            std::string key =
-                em->attributes.key.empty() ?
-                std::format("\"{}\"", em->name) :
-                em->attributes.key;
-            result += std::format("{},", key);
+            if (em->attributes.key.empty()) {
+                std::format_to(std::back_inserter(result), "\"{}\",", em->name);
+            }
+            else {
+                std::format_to(std::back_inserter(result), "{},", em->attributes.key);
+            }
         }
         // The last element has a , at the end that we can overwrite
         result.pop_back();
         result += "});\n";
-
-        return result;
     }
 
-    std::string writeVariableDocumentation(Struct* s, Variable* var) {
+    void writeVariableDocumentation(std::string& result, Struct* s, Variable* var) {
         const bool isOptional = var->type->tag == VariableType::Tag::OptionalType;
 
         std::string ver = fqn(s, "_");
         std::string v = verifier(var->type, *var, s);
         if (var->comment.empty()) {
-            std::string result = std::format(
+            std::format_to(
+                std::back_inserter(result),
                 "    codegen_{}->documentations.emplace_back({},{},{},{});\n",
                 ver,
                 var->key,
@@ -422,12 +449,13 @@ namespace {
                 isOptional ? "Optional::Yes" : "Optional::No",
                 var->attributes.isPrivate ? "Private::Yes" : "Private::No"
             );
-            return result;
         }
         else {
             var->comment = resolveComment(var->comment);
-            std::string result = std::format(
-                "    codegen_{}->documentations.emplace_back({},{},{},{},{});\n",
+            std::format_to(
+                std::back_inserter(result),
+                "    codegen_{}->documentations.emplace_back({},{},{},{},"
+                "withDescriptions ? std::string({}) : std::string());\n",
                 ver,
                 var->key,
                 v,
@@ -435,21 +463,21 @@ namespace {
                 var->attributes.isPrivate ? "Private::Yes" : "Private::No",
                 var->comment
             );
-            return result;
         }
     }
 
-    std::string writeStructDocumentation(Struct* s) {
+    void writeStructDocumentation(std::string& result, Struct* s) {
         std::string name = fqn(s, "_");
-        std::string result;
         if (s->parent) {
-            result = std::format(
+            std::format_to(
+                std::back_inserter(result),
                 "    std::shared_ptr<TableVerifier> codegen_{} = std::make_shared<TableVerifier>();\n", name
             );
         }
         else {
             // Root struct
-            result = std::format(
+            std::format_to(
+                std::back_inserter(result),
                 "    TableVerifier codegen_{0}_content;\n"
                 "    TableVerifier* codegen_{0} = &codegen_{0}_content;\n"
                 , name
@@ -458,21 +486,20 @@ namespace {
 
         for (StackElement* e : s->children) {
             if (e->type == StackElement::Type::Struct) {
-                result += writeStructDocumentation(static_cast<Struct*>(e));
+                writeStructDocumentation(result, static_cast<Struct*>(e));
             }
             if (e->type == StackElement::Type::Enum) {
-                result += writeEnumDocumentation(static_cast<Enum*>(e));
+                writeEnumDocumentation(result, static_cast<Enum*>(e));
             }
         }
 
         for (Variable* var : s->variables) {
-            result += writeVariableDocumentation(s, var);
+            writeVariableDocumentation(result, s, var);
         }
-
-        return result;
     }
 
-    std::string writeVariantConverter(Variable* var, std::vector<std::string>& converters)
+    void writeVariantConverter(std::string& result, Variable* var,
+                               std::vector<std::string>& converters)
     {
         VariableType* type = var->type;
         if (var->type->tag == VariableType::Tag::OptionalType) {
@@ -485,7 +512,7 @@ namespace {
 
         if (type->tag != VariableType::Tag::VariantType) {
             // No need to even look at non-variant types here
-            return "";
+            return;
         }
         VariantType* variantType = static_cast<VariantType*>(type);
 
@@ -497,11 +524,12 @@ namespace {
             // multiple variables in the same struct. If that is the case, we only want to
             // emit the conversion code once, or else we would get a multiply defined
             // function definition compile error
-            return "";
+            return;
         }
         converters.push_back(typeString);
 
-        std::string res = std::format(
+        std::format_to(
+            std::back_inserter(result),
             "[[maybe_unused]] "
             "void bakeTo(const ghoul::Dictionary& d, std::string_view key, {}* val) {{\n",
             typeString
@@ -514,62 +542,212 @@ namespace {
                 t->isCustomType() &&
                 static_cast<CustomType*>(t)->type->type == StackElement::Type::Enum;
             if (t->isVectorType()) {
-                const std::string bakeFunction = vectorBakeFunctionForType(typeName);
-                res += bakeFunction;
+                result += vectorBakeFunctionForType(typeName);
             }
             else if (isEnumType) {
                 const std::string fqnType = fqn(static_cast<CustomType*>(t)->type, "::");
-                const std::string bakeFunction = enumBakeFunctionForType(fqnType);
-                res += bakeFunction;
+                result += enumBakeFunctionForType(fqnType);
             }
             else {
                 const std::string_view convFunc =
                     variantConversionFunctionForType(typeName);
                 assert(!convFunc.empty());
-                res += convFunc;
+                result += convFunc;
             }
         }
 
-        res += "    // Any of the previous values should have triggered and returned\n";
-        res += "    // If this assert triggers, something in the codegen went wrong\n";
-        res += "    assert(false);\n";
-        res += "}\n";
-        return res;
+        result +=
+            "    // Any of the previous values should have triggered and returned\n"
+            "    // If this assert triggers, something in the codegen went wrong\n"
+            "    assert(false);\n"
+            "}\n";
+    }
+
+    // Returns the content of the string literal `key` without the enclosing quotes, or
+    // std::nullopt if the key is not a plain string literal without escape sequences
+    std::optional<std::string_view> unquotedKey(std::string_view key) {
+        if (key.size() < 2 || key.front() != '"' || key.back() != '"') {
+            return std::nullopt;
+        }
+        key = key.substr(1, key.size() - 2);
+        if (key.find_first_of("\\\"") != std::string_view::npos) {
+            return std::nullopt;
+        }
+        return key;
+    }
+
+    std::string charLiteral(char c) {
+        switch (c) {
+            case '\'': return "'\\''";
+            case '\\': return "'\\\\'";
+            default:
+                if (std::isprint(static_cast<unsigned char>(c))) {
+                    return std::format("'{}'", c);
+                }
+                else {
+                    return std::format("'\\x{:02x}'", static_cast<unsigned char>(c));
+                }
+        }
     }
 
-    std::string writeInnerEnumConverter(Enum* e) {
+    // Writes the code that compares the string `variable` against all keys of the enum
+    // and executes the statement returned by `onMatch` for the matching element. That
+    // statement has to leave the function. For enums with at least EnumDispatchThreshold
+    // elements, the comparison is dispatched on the length of the string first and then
+    // on a character in which all keys of that length differ, so that at most one full
+    // string comparison is needed
+    template <typename Func>
+    void writeEnumKeyComparisons(std::string& result, const Enum* e,
+                                 std::string_view variable, Func onMatch)
+    {
+        struct Key {
+            std::string_view value;
+            const EnumElement* element = nullptr;
+        };
+        std::vector<Key> keys;
+        keys.reserve(e->elements.size());
+        for (const EnumElement* elem : e->elements) {
+            std::optional<std::string_view> key = unquotedKey(elem->attributes.key);
+            if (!key.has_value()) {
+                break;
+            }
+            keys.push_back({ *key, elem });
+        }
+
+        const bool useDispatch =
+            static_cast<int>(e->elements.size()) >= EnumDispatchThreshold &&
+            keys.size() == e->elements.size();
+        if (!useDispatch) {
+            for (const EnumElement* elem : e->elements) {
+                std::format_to(
+                    std::back_inserter(result),
+                    "    if ({} == {}) {{ {} }}\n",
+                    variable, elem->attributes.key, onMatch(elem)
+                );
+            }
+            return;
+        }
+
+        // The stable sort keeps the elements that share the same key in their original
+        // order so that the first one of them still wins
+        std::stable_sort(
+            keys.begin(), keys.end(),
+            [](const Key& lhs, const Key& rhs) {
+                return lhs.value.size() < rhs.value.size();
+            }
+        );
+
+        std::format_to(
+            std::back_inserter(result),
+            "    switch ({}.size()) {{\n", variable
+        );
+        for (auto begin = keys.begin(); begin != keys.end();) {
+            const size_t length = begin->value.size();
+            auto end = std::find_if(
+                begin, keys.end(),
+                [length](const Key& k) { return k.value.size() != length; }
+            );
+
+            // Find the character position that splits the keys of this length into the
+            // most groups. Ideally, all keys differ in that position
+            const size_t nKeys = static_cast<size_t>(std::distance(begin, end));
+            size_t position = 0;
+            size_t nGroups = 1;
+            for (size_t i = 0; i < length && nGroups < nKeys; i++) {
+                std::string chars;
+                for (auto it = begin; it != end; it++) {
+                    chars.push_back(it->value[i]);
+                }
+                std::sort(chars.begin(), chars.end());
+                const size_t n = static_cast<size_t>(std::distance(
+                    chars.begin(),
+                    std::unique(chars.begin(), chars.end())
+                ));
+                if (n > nGroups) {
+                    position = i;
+                    nGroups = n;
+                }
+            }
+
+            std::format_to(std::back_inserter(result), "        case {}:\n", length);
+            if (nGroups > 1) {
+                std::format_to(
+                    std::back_inserter(result),
+                    "            switch ({}[{}]) {{\n", variable, position
+                );
+                std::string written;
+                for (auto it = begin; it != end; it++) {
+                    const char c = it->value[position];
+                    if (written.find(c) != std::string::npos) {
+                        continue;
+                    }
+                    written.push_back(c);
+
+                    std::format_to(
+                        std::back_inserter(result),
+                        "                case {}:\n", charLiteral(c)
+                    );
+                    for (auto jt = it; jt != end; jt++) {
+                        if (jt->value[position] == c) {
+                            std::format_to(
+                                std::back_inserter(result),
+                                "                    if ({} == \"{}\") {{ {} }}\n",
+                                variable, jt->value, onMatch(jt->element)
+                            );
+                        }
+                    }
+                    result += "                    break;\n";
+                }
+                result += "            }\n";
+            }
+            else {
+                for (auto it = begin; it != end; it++) {
+                    std::format_to(
+                        std::back_inserter(result),
+                        "            if ({} == \"{}\") {{ {} }}\n",
+                        variable, it->value, onMatch(it->element)
+                    );
+                }
+            }
+            result += "            break;\n";
+
+            begin = end;
+        }
+        result += "    }\n";
+    }
+
+    void writeInnerEnumConverter(std::string& result, Enum* e) {
         std::string type = fqn(e, "::");
-        std::string result = std::format(
+        std::format_to(
+            std::back_inserter(result),
             "[[maybe_unused]] "
             "void bakeTo(const ghoul::Dictionary& d, std::string_view key, {}* val) {{\n"
             "    std::string v = d.value<std::string>(key);\n",
             type
         );
 
-        for (EnumElement* elem : e->elements) {
-            assert(elem);
-            std::string typeStr = fqn(e, "::");
-            assert(!elem->attributes.key.empty());
-            result += std::format(
-                "    if (v == {}) {{ *val = {}::{}; }}\n",
-                elem->attributes.key, typeStr, elem->name
-            );
-        }
+        writeEnumKeyComparisons(
+            result, e, "v",
+            [&type](const EnumElement* elem) {
+                assert(elem);
+                assert(!elem->attributes.key.empty());
+                return std::format("*val = {}::{}; return;", type, elem->name);
+            }
+        );
         result += "}\n";
-
-        return result;
     }
 
-    std::string writeEnumConverterToString(const Enum* e) {
+    void writeEnumConverterToString(std::string& res, const Enum* e) {
         assert(e);
-        std::string res = std::format(R"(
-    template <> [[maybe_unused]] std::string_view toString<{0}>({0} t) {{
+        std::format_to(std::back_inserter(res), R"(
+    template <> [[maybe_unused]] {1}std::string_view toString<{0}>({0} t) {{
         switch (t) {{
     )",
-    fqn(e, "::")
+    fqn(e, "::"), e->attributes.isConstexpr ? "constexpr " : ""
     );
         for (EnumElement* elem : e->elements) {
-            res += std::format(
+            std::format_to(
+                std::back_inserter(res),
                 "        case {0}::{1}: return {2};\n",
                 fqn(e, "::"), elem->name, elem->attributes.key
             );
@@ -577,60 +755,60 @@ namespace {
         res += R"(        default: throw "This default label is not necessary since the case labels are "
                            "exhaustive, but not having it makes Visual Studio cranky";)";
         res += "\n    }\n}\n";
-        return res;
     }
 
-    std::string writeEnumConverterFromString(const Enum* e) {
+    void writeEnumConverterFromString(std::string& res, const Enum* e) {
         assert(e);
 
-        std::string res = std::format(
-            "template <> [[maybe_unused]] {0} fromString<{0}>(std::string_view sv) {{\n",
-            fqn(e, "::")
+        std::format_to(
+            std::back_inserter(res),
+            "template <> [[maybe_unused]] {1}{0} fromString<{0}>(std::string_view sv) {{\n",
+            fqn(e, "::"), e->attributes.isConstexpr ? "constexpr " : ""
+        );
+        const std::string type = fqn(e, "::");
+        writeEnumKeyComparisons(
+            res, e, "sv",
+            [&type](const EnumElement* elem) {
+                return std::format("return {}::{};", type, elem->name);
+            }
         );
-        for (EnumElement* elem : e->elements) {
-            res += std::format("    if (sv == {0}) {{ return {1}::{2}; }}\n",
-                elem->attributes.key, fqn(e, "::"), elem->name
-            );
-        }
         res += "    throw std::runtime_error(std::format(\"Could not find value '{}' in enum\", sv));\n";
         res += "}\n";
-        return res;
     }
 
-    std::string writeEnumConverterBake(const Enum* e) {
-        return std::format(BakeEnum, fqn(e, "::"));
+    void writeEnumConverterBake(std::string& result, const Enum* e) {
+        std::format_to(std::back_inserter(result), BakeEnum, fqn(e, "::"));
     }
 
-    std::string writeStructConverter(Struct* s,
-                                     std::vector<std::string>& writtenVariantConverters)
+    void writeStructConverter(std::string& result, Struct* s,
+                              std::vector<std::string>& writtenVariantConverters)
     {
         assert(s);
-        std::string result;
 
         for (StackElement* el : s->children) {
             assert(el);
             if (el->type == StackElement::Type::Struct) {
                 Struct* sl = static_cast<Struct*>(el);
-                result += writeStructConverter(sl, writtenVariantConverters);
+                writeStructConverter(result, sl, writtenVariantConverters);
             }
 
             if (el->type == StackElement::Type::Enum) {
                 Enum* e = static_cast<Enum*>(el);
-                result += writeInnerEnumConverter(e);
+                writeInnerEnumConverter(result, e);
             }
         }
 
         for (Variable* var : s->variables) {
             assert(var);
-            result += writeVariantConverter(var, writtenVariantConverters);
+            writeVariantConverter(result, var, writtenVariantConverters);
         }
 
         if (s->parent == nullptr) {
-            return result;
+            return;
         }
 
         std::string name = fqn(s, "::");
-        result += std::format(R"(template <> [[maybe_unused]] void bakeTo<{0}>(const ghoul::Dictionary& d, std::string_view key, {0}* val) {{
+        std::format_to(std::back_inserter(result), R"(template <> [[maybe_unused]] void bakeTo<{0}>(const ghoul::Dictionary& d, std::string_view key, {0}* val) {{
         {0}& res = *val;
         ghoul::Dictionary dict = d.value<ghoul::Dictionary>(key);
     )",
@@ -638,21 +816,558 @@ namespace {
         );
 
         for (Variable* var : s->variables) {
-            result += std::format(
+            std::format_to(
+                std::back_inserter(result),
                 "    internal::bakeTo(dict, {}, &res.{});\n", var->key, var->name
             );
         }
 
         result += "}\n";
-        return result;
     }
 
-    std::string emitWarningsForDocumentationLessTypes(Struct* s,
-                                                      std::string_view sourceFile)
+    // Returns the check for a variable of the provided type that can be evaluated inline
+    // in a fused bake function, or an empty string if no check is necessary apart from
+    // the type of the value. If the verifier for the type does more than can be checked
+    // inline, std::nullopt is returned instead. Each check has to be at least as strict
+    // as the corresponding verifier, or invalid values would be accepted
+    std::optional<std::string> inlineCheck(BasicType::Type type,
+                                           const Variable::Attributes& attributes)
     {
-        assert(s);
+        using Type = BasicType::Type;
+
+        std::vector<std::string> checks;
+        switch (type) {
+            case Type::Bool:
+                break;
+            case Type::Int:
+            case Type::Double:
+            {
+                // The verifiers convert their parameters to the verified type first
+                const std::string_view t = type == Type::Int ? "int" : "double";
+                if (!attributes.inrange.empty()) {
+                    checks.push_back(std::format(
+                        "internal::inRange<{}>(v, {})", t, attributes.inrange
+                    ));
+                }
+                if (!attributes.notinrange.empty()) {
+                    checks.push_back(std::format(
+                        "!internal::inRange<{}>(v, {})", t, attributes.notinrange
+                    ));
+                }
+                if (!attributes.less.empty()) {
+                    checks.push_back(
+                        std::format("v < static_cast<{}>({})", t, attributes.less)
+                    );
+                }
+                if (!attributes.lessequal.empty()) {
+                    checks.push_back(
+                        std::format("v <= static_cast<{}>({})", t, attributes.lessequal)
+                    );
+                }
+                if (!attributes.greater.empty()) {
+                    checks.push_back(
+                        std::format("v > static_cast<{}>({})", t, attributes.greater)
+                    );
+                }
+                if (!attributes.greaterequal.empty()) {
+                    checks.push_back(std::format(
+                        "v >= static_cast<{}>({})", t, attributes.greaterequal
+                    ));
+                }
+                if (!attributes.unequal.empty()) {
+                    checks.push_back(
+                        std::format("v != static_cast<{}>({})", t, attributes.unequal)
+                    );
+                }
+                break;
+            }
+            case Type::Float:
+                // The verifier checks the double value before it is converted to a
+                // float, which can't be reproduced after baking
+                if (!attributes.inrange.empty() || !attributes.notinrange.empty() ||
+                    !attributes.less.empty() || !attributes.lessequal.empty() ||
+                    !attributes.greater.empty() || !attributes.greaterequal.empty() ||
+                    !attributes.unequal.empty())
+                {
+                    return std::nullopt;
+                }
+                break;
+            case Type::String:
+                if (attributes.isDateTime || attributes.isIdentifier) {
+                    return std::nullopt;
+                }
+                if (!attributes.inlist.empty()) {
+                    checks.push_back(
+                        std::format("internal::inList(v, {{ {} }})", attributes.inlist)
+                    );
+                }
+                if (!attributes.notinlist.empty()) {
+                    checks.push_back(std::format(
+                        "!internal::inList(v, {{ {} }})", attributes.notinlist
+                    ));
+                }
+                if (!attributes.unequal.empty()) {
+                    checks.push_back(std::format("v != {}", attributes.unequal));
+                }
+                if (attributes.mustBeNotEmpty) {
+                    checks.push_back("!v.empty()");
+                }
+                break;
+            default:
+                return std::nullopt;
+        }
 
         std::string res;
+        for (const std::string& check : checks) {
+            if (!res.empty()) {
+                res += " && ";
+            }
+            res += check;
+        }
+        return res;
+    }
+
+    // Returns the expression that checks and bakes the variable in a fused bake function.
+    // `index` is the index of the variable's entry in the struct's documentation
+    std::string fusedBakeExpression(const Variable* var, size_t index) {
+        assert(var);
+
+        const VariableType* type = var->type;
+        if (type->isOptionalType()) {
+            type = static_cast<const OptionalType*>(type)->type;
+        }
+
+        std::optional<std::string> check;
+        if (type->isBasicType()) {
+            const BasicType* bt = static_cast<const BasicType*>(type);
+            check = inlineCheck(bt->type, var->attributes);
+        }
+
+        if (!check.has_value()) {
+            return std::format(
+                "internal::verifiedBakeTo(dict, {}, &res.{}, *Doc.entries[{}].verifier)",
+                var->key, var->name, index
+            );
+        }
+        else if (check->empty()) {
+            return std::format(
+                "internal::fusedBakeTo(dict, {}, &res.{})", var->key, var->name
+            );
+        }
+        else {
+            return std::format(
+                "internal::fusedBakeTo(dict, {}, &res.{}, "
+                "[](const auto& v) {{ return {}; }})",
+                var->key, var->name, *check
+            );
+        }
+    }
+
+    // Returns whether luawrap functions can read the struct directly from a Lua table.
+    // This requires that all variables can be checked inline and, as the reader does not
+    // look at any other values in the table, that the struct accepts unknown keys
+    bool isLuaReadable(const Struct* s) {
+        assert(s);
+
+        if (s->attributes.dictionary.empty() || !s->attributes.noExhaustive) {
+            return false;
+        }
+
+        for (const Variable* var : s->variables) {
+            const VariableType* type = var->type;
+            if (type->isOptionalType()) {
+                type = static_cast<const OptionalType*>(type)->type;
+            }
+
+            if (!type->isBasicType()) {
+                return false;
+            }
+            const BasicType* bt = static_cast<const BasicType*>(type);
+            if (!inlineCheck(bt->type, var->attributes).has_value()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns the struct if the argument at position `i` of the function is read directly
+    // from the Lua stack, or nullptr if it is extracted as a ghoul::Dictionary. The
+    // position of the argument on the stack is only known if none of the preceding
+    // arguments are optional
+    const Struct* directLuaArgument(const Function* f, size_t i) {
+        assert(f);
+        assert(i < f->arguments.size());
+
+        for (size_t j = 0; j < i; j++) {
+            if (f->arguments[j]->type->isOptionalType()) {
+                return nullptr;
+            }
+        }
+
+        const VariableType* type = f->arguments[i]->type;
+        if (!type->isCustomType()) {
+            return nullptr;
+        }
+        const CustomType* ct = static_cast<const CustomType*>(type);
+        if (!ct->type || ct->type->type != StackElement::Type::Struct) {
+            return nullptr;
+        }
+        const Struct* s = static_cast<const Struct*>(ct->type);
+        return isLuaReadable(s) ? s : nullptr;
+    }
+
+    // Returns all structs that are read directly from the Lua stack by any function
+    std::vector<const Struct*> directLuaStructs(const Code& code) {
+        std::vector<const Struct*> res;
+        for (const Function* f : code.luaWrapperFunctions) {
+            for (size_t i = 0; i < f->arguments.size(); i++) {
+                const Struct* s = directLuaArgument(f, i);
+                if (s && std::find(res.begin(), res.end(), s) == res.end()) {
+                    res.push_back(s);
+                }
+            }
+        }
+        return res;
+    }
+
+    // Adds the structs that are part of the type, and the structs used by their variables,
+    // to `res`. These are the structs that have to be pushed onto the Lua stack as tables
+    // if a value of the type is returned from a luawrap function
+    void collectLuaPushStructs(const VariableType* type, std::vector<const Struct*>& res)
+    {
+        assert(type);
+
+        switch (type->tag) {
+            case VariableType::Tag::OptionalType:
+                collectLuaPushStructs(static_cast<const OptionalType*>(type)->type, res);
+                break;
+            case VariableType::Tag::VectorType:
+                collectLuaPushStructs(static_cast<const VectorType*>(type)->type, res);
+                break;
+            case VariableType::Tag::MapType: {
+                const MapType* mt = static_cast<const MapType*>(type);
+                if (mt->hasStringKey()) {
+                    collectLuaPushStructs(mt->valueType, res);
+                }
+                break;
+            }
+            case VariableType::Tag::VariantType:
+                for (const VariableType* t : static_cast<const VariantType*>(type)->types) {
+                    collectLuaPushStructs(t, res);
+                }
+                break;
+            case VariableType::Tag::CustomType: {
+                const CustomType* ct = static_cast<const CustomType*>(type);
+                if (!ct->type || ct->type->type != StackElement::Type::Struct) {
+                    break;
+                }
+                const Struct* s = static_cast<const Struct*>(ct->type);
+                if (std::find(res.begin(), res.end(), s) == res.end()) {
+                    res.push_back(s);
+                    for (const Variable* var : s->variables) {
+                        collectLuaPushStructs(var->type, res);
+                    }
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // Returns the function that pushes a value of the type onto the Lua stack
+    std::string_view luaPushFunction(const VariableType* type) {
+        std::vector<const Struct*> structs;
+        collectLuaPushStructs(type, structs);
+        return structs.empty() ? "ghoul::lua::push" : "codegen::internal::luaPush";
+    }
+
+    // Returns the expression that reads and checks the variable from a Lua table
+    std::string luaBakeExpression(const Variable* var) {
+        assert(var);
+
+        const VariableType* type = var->type;
+        if (type->isOptionalType()) {
+            type = static_cast<const OptionalType*>(type)->type;
+        }
+        assert(type->isBasicType());
+        const BasicType* bt = static_cast<const BasicType*>(type);
+        std::optional<std::string> check = inlineCheck(bt->type, var->attributes);
+        assert(check.has_value());
+
+        if (check->empty()) {
+            return std::format(
+                "luaBakeTo(L, index, {}, &res.{})", var->key, var->name
+            );
+        }
+        else {
+            return std::format(
+                "luaBakeTo(L, index, {}, &res.{}, [](const auto& v) {{ return {}; }})",
+                var->key, var->name, *check
+            );
+        }
+    }
+
+    // The layout of a serialized root struct. The `hash` describes the members and their
+    // types. The values of the `nativeTypes` are copied with the byte order and size that
+    // they have on the platform, which are only known when the code is compiled
+    struct SerializationLayout {
+        uint64_t hash = 0;
+        std::vector<std::string> nativeTypes;
+    };
+
+    // Appends a description of everything that determines the binary layout of a
+    // serialized value of the provided type. Returns false if the type can't be
+    // serialized, which is the case for ghoul::Dictionary. `visited` contains the structs
+    // that are currently being described to stop the recursion of self-referencing types.
+    // Types whose values are copied as they are in memory are added to `nativeTypes`
+    bool appendSerializationShape(std::string& res, const VariableType* type,
+                                  std::vector<const Struct*>& visited,
+                                  std::vector<std::string>& nativeTypes)
+    {
+        assert(type);
+
+        auto addNativeType = [&nativeTypes](std::string name) {
+            if (std::find(nativeTypes.begin(), nativeTypes.end(), name) ==
+                nativeTypes.end())
+            {
+                nativeTypes.push_back(std::move(name));
+            }
+        };
+
+        auto appendList = [&](std::string_view name, const auto& types) {
+            res += name;
+            res += '<';
+            for (const VariableType* t : types) {
+                if (!appendSerializationShape(res, t, visited, nativeTypes)) {
+                    return false;
+                }
+                res += ',';
+            }
+            res += '>';
+            return true;
+        };
+
+        switch (type->tag) {
+            case VariableType::Tag::BasicType:
+            {
+                const BasicType* bt = static_cast<const BasicType*>(type);
+                res += generateTypename(bt->type);
+                // Booleans, strings, and paths are written with a fixed layout
+                if (bt->type != BasicType::Type::Bool &&
+                    bt->type != BasicType::Type::String &&
+                    bt->type != BasicType::Type::Path &&
+                    bt->type != BasicType::Type::Dictionary)
+                {
+                    addNativeType(std::string(generateTypename(bt->type)));
+                }
+                return bt->type != BasicType::Type::Dictionary;
+            }
+            case VariableType::Tag::PointerType:
+                return false;
+            case VariableType::Tag::MapType:
+            {
+                const MapType* mt = static_cast<const MapType*>(type);
+                return appendList("map", std::array{ mt->keyType, mt->valueType });
+            }
+            case VariableType::Tag::OptionalType:
+            {
+                const OptionalType* ot = static_cast<const OptionalType*>(type);
+                return appendList("optional", std::array{ ot->type });
+            }
+            case VariableType::Tag::VariantType:
+                return appendList(
+                    "variant", static_cast<const VariantType*>(type)->types
+                );
+            case VariableType::Tag::TupleType:
+                return appendList("tuple", static_cast<const TupleType*>(type)->types);
+            case VariableType::Tag::ArrayType:
+            {
+                const ArrayType* at = static_cast<const ArrayType*>(type);
+                res += std::to_string(at->size);
+                return appendList("array", std::array{ at->type });
+            }
+            case VariableType::Tag::VectorType:
+            {
+                const VectorType* vt = static_cast<const VectorType*>(type);
+                return appendList("vector", std::array{ vt->type });
+            }
+            case VariableType::Tag::CustomType:
+            {
+                const CustomType* ct = static_cast<const CustomType*>(type);
+                assert(ct->type);
+                res += fqn(ct->type, "::");
+                if (ct->type->type == StackElement::Type::Enum) {
+                    // Enums are serialized as their underlying value, so the order of
+                    // the elements matters
+                    const Enum* e = static_cast<const Enum*>(ct->type);
+                    addNativeType(fqn(e, "::"));
+                    res += '{';
+                    for (const EnumElement* el : e->elements) {
+                        res += el->name;
+                        res += ',';
+                    }
+                    res += '}';
+                    return true;
+                }
+
+                const Struct* st = static_cast<const Struct*>(ct->type);
+                if (std::find(visited.begin(), visited.end(), st) != visited.end()) {
+                    return true;
+                }
+                visited.push_back(st);
+                res += '{';
+                for (const Variable* var : st->variables) {
+                    res += var->name;
+                    res += ':';
+                    if (!appendSerializationShape(res, var->type, visited, nativeTypes)) {
+                        return false;
+                    }
+                    res += ';';
+                }
+                res += '}';
+                visited.pop_back();
+                return true;
+            }
+            default:
+                throw std::logic_error("Missing case label");
+        }
+    }
+
+    // Returns the layout of the serialized root struct or std::nullopt if the struct
+    // contains a type that can't be serialized
+    std::optional<SerializationLayout> serializationLayout(const Struct* s) {
+        assert(s);
+
+        // Changing the way values are serialized has to change this version
+        std::string shape = "2:";
+        SerializationLayout res;
+        std::vector<const Struct*> visited = { s };
+        for (const Variable* var : s->variables) {
+            shape += var->name;
+            shape += ':';
+            if (!appendSerializationShape(shape, var->type, visited, res.nativeTypes)) {
+                return std::nullopt;
+            }
+            shape += ';';
+        }
+        res.hash = hashContent(shape);
+        return res;
+    }
+
+    // Adds the structs that are part of the type, and the structs used by their members,
+    // to `res`. These are the structs that need serialization functions if a value of the
+    // type is serialized
+    void collectSerializedStructs(const VariableType* type,
+                                  std::vector<const Struct*>& res)
+    {
+        assert(type);
+
+        switch (type->tag) {
+            case VariableType::Tag::OptionalType: {
+                const OptionalType* ot = static_cast<const OptionalType*>(type);
+                collectSerializedStructs(ot->type, res);
+                break;
+            }
+            case VariableType::Tag::VectorType: {
+                const VectorType* vt = static_cast<const VectorType*>(type);
+                collectSerializedStructs(vt->type, res);
+                break;
+            }
+            case VariableType::Tag::ArrayType: {
+                const ArrayType* at = static_cast<const ArrayType*>(type);
+                collectSerializedStructs(at->type, res);
+                break;
+            }
+            case VariableType::Tag::MapType: {
+                const MapType* mt = static_cast<const MapType*>(type);
+                collectSerializedStructs(mt->keyType, res);
+                collectSerializedStructs(mt->valueType, res);
+                break;
+            }
+            case VariableType::Tag::VariantType: {
+                const VariantType* vt = static_cast<const VariantType*>(type);
+                for (const VariableType* t : vt->types) {
+                    collectSerializedStructs(t, res);
+                }
+                break;
+            }
+            case VariableType::Tag::TupleType: {
+                const TupleType* tt = static_cast<const TupleType*>(type);
+                for (const VariableType* t : tt->types) {
+                    collectSerializedStructs(t, res);
+                }
+                break;
+            }
+            case VariableType::Tag::CustomType: {
+                const CustomType* ct = static_cast<const CustomType*>(type);
+                if (!ct->type || ct->type->type != StackElement::Type::Struct) {
+                    break;
+                }
+                const Struct* s = static_cast<const Struct*>(ct->type);
+                if (std::find(res.begin(), res.end(), s) == res.end()) {
+                    res.push_back(s);
+                    for (const Variable* var : s->variables) {
+                        collectSerializedStructs(var->type, res);
+                    }
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    void writeStructSerializers(std::string& result, const Struct* s, bool declaration) {
+        assert(s);
+
+        const std::string name = fqn(s, "::");
+        if (declaration) {
+            std::format_to(
+                std::back_inserter(result),
+                "[[maybe_unused]] void serializeTo(std::vector<std::byte>& buffer, "
+                "const {0}& value);\n"
+                "[[maybe_unused]] void deserializeFrom(std::span<const std::byte>& data, "
+                "{0}* value);\n",
+                name
+            );
+            return;
+        }
+
+        std::format_to(
+            std::back_inserter(result),
+            "[[maybe_unused]] void serializeTo([[maybe_unused]] std::vector<std::byte>& "
+            "buffer, [[maybe_unused]] const {}& value) {{\n",
+            name
+        );
+        for (const Variable* var : s->variables) {
+            std::format_to(
+                std::back_inserter(result),
+                "    serializeTo(buffer, value.{});\n", var->name
+            );
+        }
+        result += "}\n";
+
+        std::format_to(
+            std::back_inserter(result),
+            "[[maybe_unused]] void deserializeFrom([[maybe_unused]] std::span<const "
+            "std::byte>& data, [[maybe_unused]] {}* value) {{\n",
+            name
+        );
+        for (const Variable* var : s->variables) {
+            std::format_to(
+                std::back_inserter(result),
+                "    deserializeFrom(data, &value->{});\n", var->name
+            );
+        }
+        result += "}\n";
+    }
+
+    void emitWarningsForDocumentationLessTypes(std::string& res, Struct* s,
+                                               std::string_view sourceFile)
+    {
+        assert(s);
+
         for (Variable* var : s->variables) {
             assert(var);
             if (var->comment.empty()) {
@@ -661,17 +1376,18 @@ namespace {
                     "\"{}: [CODEGEN] {} is not documented\"", sourceFile, identifier
                 );
 #ifdef WIN32
-                res += std::format("#pragma message({})\n", message);
+                std::format_to(std::back_inserter(res), "#pragma message({})\n", message);
 #else // ^^^^ WIN32 // !WIN32 vvvv
-                res += std::format("#warning {}\n", message);
+                std::format_to(std::back_inserter(res), "#warning {}\n", message);
 #endif // WIN32
             }
         }
-        return res;
     }
 
 
-    std::string generateStructsResult(const Code& code, HeaderInfo& info) {
+    void generateStructsResult(std::string& result, const Code& code,
+                               const std::vector<const VariableType*>& types)
+    {
         // For Linux, we need to declare the functions in the following order or the
         // overload resolution picks the top fall back implentation and triggers a
         // static_assert:
@@ -690,23 +1406,23 @@ namespace {
         // implementation. For ease of implementation, we are putting 3&4 before 2 instead
 
         if (code.structs.empty()) {
-            return "";
+            return;
         }
 
-        std::string result;
         result += "namespace codegen {\n\n";
         result += DocumentationFallback;
         result += DocumentationPackOverload;
 
         for (Struct* s : code.structs) {
-            result += std::format(DocumentationPreamble, s->name);
+            std::format_to(std::back_inserter(result), DocumentationPreamble, s->name);
 
             if (GenerateWarningsForDocumentationLessTypes) {
-                result += emitWarningsForDocumentationLessTypes(s, code.sourceFile);
+                emitWarningsForDocumentationLessTypes(result, s, code.sourceFile);
             }
 
-            result += writeStructDocumentation(s);
-            result += std::format(
+            writeStructDocumentation(result, s);
+            std::format_to(
+                std::back_inserter(result),
                 DocumentationEpilog,
                 s->attributes.dictionary, s->name, s->comment
             );
@@ -716,7 +1432,6 @@ namespace {
         result += BakeToFunctionFallback;
         result += "\n\n";
 
-        const std::vector<const VariableType*> types = usedTypes(code.structs);
         bool hasOptionalType = false;
         bool hasVectorType = false;
         bool hasArrayType = false;
@@ -750,7 +1465,6 @@ namespace {
             result += BakeFunctionMapStringKeyDeclaration;
         }
         if (hasMapEnumKeyType) {
-            info.needsFromStringFallback = true;
             result += BakeFunctionMapEnumKeyDeclaration;
         }
         if (hasTupleType) {
@@ -765,7 +1479,7 @@ namespace {
 
         std::vector<std::string> writtenVariantConverters;
         for (Struct* s : code.structs) {
-            result += writeStructConverter(s, writtenVariantConverters);
+            writeStructConverter(result, s, writtenVariantConverters);
         }
 
         if (hasOptionalType) {
@@ -786,57 +1500,170 @@ namespace {
         if (hasTupleType) {
             result += BakeFunctionTuple;
         }
+        const bool hasFusedBake = std::any_of(
+            code.structs.begin(), code.structs.end(),
+            [](const Struct* s) { return s->attributes.fusedBake; }
+        );
+        if (hasFusedBake) {
+            result += FusedBakeFunctions;
+        }
+        if (hasFusedBake || !directLuaStructs(code).empty()) {
+            result += InlineCheckFunctions;
+        }
+
+        std::vector<std::pair<const Struct*, SerializationLayout>> serializable;
+        for (const Struct* s : code.structs) {
+            if (!s->attributes.serialize) {
+                continue;
+            }
+            std::optional<SerializationLayout> layout = serializationLayout(s);
+            if (!layout.has_value()) {
+                throw CodegenError(std::format(
+                    "Struct '{}' is marked with codegen::serialize, but contains a type "
+                    "that can't be serialized", s->name
+                ));
+            }
+            serializable.emplace_back(s, std::move(*layout));
+        }
+
+        if (!serializable.empty()) {
+            bool hasPathType = false;
+            bool hasVariantType = false;
+            for (const VariableType* t : types) {
+                hasPathType |= t->isBasicType() &&
+                    static_cast<const BasicType*>(t)->type == BasicType::Type::Path;
+                hasVariantType |= t->isVariantType();
+            }
+
+            // Same as for the bake functions, all functions have to be declared before
+            // the functions for the structs and the definitions come afterwards
+            result += SerializeFunctionDeclarations;
+            result += hasPathType ? SerializeFunctionPathDeclaration : "";
+            result += hasOptionalType ? SerializeFunctionOptionalDeclaration : "";
+            result += hasVectorType ? SerializeFunctionVectorDeclaration : "";
+            result += hasArrayType ? SerializeFunctionArrayDeclaration : "";
+            const bool hasMapType = hasMapStringKeyType || hasMapEnumKeyType;
+            result += hasMapType ? SerializeFunctionMapDeclaration : "";
+            result += hasVariantType ? SerializeFunctionVariantDeclaration : "";
+            result += hasTupleType ? SerializeFunctionTupleDeclaration : "";
+
+            // Only the structs that are used by a serializable root struct get the
+            // functions as other child structs might contain types that can't be
+            // serialized
+            std::vector<const Struct*> serialized;
+            for (const auto& [s, layout] : serializable) {
+                if (std::find(serialized.begin(), serialized.end(), s) ==
+                    serialized.end())
+                {
+                    serialized.push_back(s);
+                }
+                for (const Variable* var : s->variables) {
+                    collectSerializedStructs(var->type, serialized);
+                }
+            }
+
+            for (const Struct* s : serialized) {
+                writeStructSerializers(result, s, true);
+            }
+            for (const Struct* s : serialized) {
+                writeStructSerializers(result, s, false);
+            }
+
+            result += SerializeFunctions;
+            result += hasPathType ? SerializeFunctionPath : "";
+            result += hasOptionalType ? SerializeFunctionOptional : "";
+            result += hasVectorType ? SerializeFunctionVector : "";
+            result += hasArrayType ? SerializeFunctionArray : "";
+            result += hasMapType ? SerializeFunctionMap : "";
+            result += hasVariantType ? SerializeFunctionVariant : "";
+            result += hasTupleType ? SerializeFunctionTuple : "";
+        }
 
         result += "\n} // namespace internal\n\n";
         result += BackFunctionFallback;
         result += '\n';
+        const bool hasBakeMany = std::any_of(
+            code.structs.begin(), code.structs.end(),
+            [](const Struct* s) { return s->attributes.bakeMany; }
+        );
+        if (hasBakeMany) {
+            result += BakeManyFunctions;
+        }
 
         for (Struct* s : code.structs) {
-            result += std::format(BakeStructPreamble, s->name, s->attributes.dictionary);
+            if (s->attributes.fusedBake) {
+                std::string condition;
+                for (size_t i = 0; i < s->variables.size(); i++) {
+                    condition += i == 0 ? "\n            " : " &&\n            ";
+                    condition += fusedBakeExpression(s->variables[i], i);
+                }
+                condition += s->variables.empty() ? "true" : "\n        ";
+
+                std::format_to(
+                    std::back_inserter(result),
+                    BakeStructFusedPreamble,
+                    s->name, s->attributes.dictionary, condition
+                );
+            }
+            else {
+                std::format_to(
+                    std::back_inserter(result),
+                    BakeStructPreamble,
+                    s->name, s->attributes.dictionary
+                );
+            }
 
             for (Variable* var : s->variables) {
-                result += std::format(
+                std::format_to(
+                    std::back_inserter(result),
                     "    internal::bakeTo(dict, {}, &res.{});\n", var->key, var->name
                 );
             }
 
             result += "    return res;\n}\n";
 
-            const std::vector<Enum*> enums = mappedEnums(*s);
-            if (!enums.empty()) {
-                info.needsMappingFallback = true;
+            for (Enum* e : mappedEnums(*s)) {
+                result += enumToEnumMapping(e);
             }
+        }
 
-            for (Enum* e : enums) {
-                result += enumToEnumMapping(e);
+        if (!serializable.empty()) {
+            result += SerializeFallback;
+            for (const auto& [s, layout] : serializable) {
+                std::string sizes;
+                for (const std::string& type : layout.nativeTypes) {
+                    sizes += sizes.empty() ? "" : ", ";
+                    sizes += std::format("sizeof({})", type);
+                }
+                std::format_to(
+                    std::back_inserter(result),
+                    SerializeStruct,
+                    s->name, layout.hash, sizes
+                );
             }
         }
 
         result += "\n} // namespace codegen\n\n";
-        return result;
     }
 
-    std::string generateEnumResult(const Code& code, HeaderInfo& info) {
-        const std::vector<Enum*> enums = collectEnums(code);
-
-        std::string result;
+    void generateEnumResult(std::string& result, const Code& code) {
+        // We don't know yet whether there will be any content, so we remove the opening
+        // of the namespace again at the end if nothing was written
+        const size_t begin = result.size();
+        result += "namespace codegen {\n";
+        const size_t contentBegin = result.size();
 
         // First writing out the the enums defined at the root
         for (Enum* e : code.enums) {
-            result += writeEnumConverterToString(e);
-            info.needsToStringFallback = true;
-            result += writeEnumConverterFromString(e);
-            info.needsFromStringFallback = true;
-            result += writeEnumConverterBake(e);
-            info.needsBakeEnumFallback = true;
+            writeEnumConverterToString(result, e);
+            writeEnumConverterFromString(result, e);
+            writeEnumConverterBake(result, e);
 
             if (!e->attributes.mappedTo.empty()) {
-                info.needsMappingFallback = true;
                 result += enumToEnumMapping(e);
             }
 
             if (e->attributes.arrayify) {
-                info.needsArrayifyFallback = true;
                 result += enumArrayify(e);
             }
         }
@@ -866,37 +1693,35 @@ namespace {
                 auto it = std::find(code.enums.begin(), code.enums.end(), e);
                 auto it2 = std::find(writtenEnums.begin(), writtenEnums.end(), e);
                 if (it == code.enums.end() && it2 == writtenEnums.end()) {
-                    result += writeEnumConverterFromString(e);
-                    info.needsFromStringFallback = true;
+                    writeEnumConverterFromString(result, e);
                     writtenEnums.push_back(e);
                 }
             }
         }
 
-        if (result.empty()) {
-            return "";
+        if (result.size() == contentBegin) {
+            result.resize(begin);
         }
         else {
-            return std::format(
-                "namespace codegen {{\n{}\n }} // namespace codegen\n\n",
-                result
-            );
+            result += "\n } // namespace codegen\n\n";
         }
     }
 
-    std::string generateLuaFunction(Function* f) {
+    void generateLuaFunction(std::string& result, Function* f) {
         assert(f);
-        std::string result;
         // Open the Function object declaration
         std::string capitalizedName = f->functionName;
         capitalizedName[0] = static_cast<char>(::toupper(capitalizedName[0]));
 
-        result += std::format(LuaWrapperPreamble, capitalizedName);
-        result += std::format("    \"{}\",\n", f->luaName);
+        std::format_to(std::back_inserter(result), LuaWrapperPreamble, capitalizedName);
+        std::format_to(std::back_inserter(result), "    \"{}\",\n", f->luaName);
 
         // The lambda that is executed
         result += "    [](lua_State* L) -> int {\n";
-        result += std::format("        ZoneScopedN(\"[Lua] {}\");\n", f->functionName);
+        std::format_to(
+            std::back_inserter(result),
+            "        ZoneScopedN(\"[Lua] {}\");\n", f->functionName
+        );
 
         int nRequiredArguments = 0;
         for (Variable* var : f->arguments) {
@@ -908,13 +1733,15 @@ namespace {
         // Adding the check for number of variables
         int nTotalArguments = static_cast<int>(f->arguments.size());
         if (nRequiredArguments == nTotalArguments) {
-            result += std::format(
+            std::format_to(
+                std::back_inserter(result),
                 "        ghoul::lua::checkArgumentsAndThrow(L, {}, \"{}\");\n",
                 nTotalArguments, f->luaName
             );
         }
         else {
-            result += std::format(
+            std::format_to(
+                std::back_inserter(result),
                 "        ghoul::lua::checkArgumentsAndThrow(L, {{ {}, {} }}, \"{}\");\n",
                 nRequiredArguments, nTotalArguments, f->luaName
             );
@@ -939,7 +1766,8 @@ namespace {
             Variable* var = arguments.front();
             OptionalType* ot = static_cast<OptionalType*>(var->type);
 
-            result += std::format(
+            std::format_to(
+                std::back_inserter(result),
                 LuaWrapperOptionalTypeExtraction,
                 generateTypename(ot), var->name, generateLuaExtractionTypename(ot->type)
             );
@@ -948,6 +1776,24 @@ namespace {
             arguments.erase(arguments.begin());
         }
 
+        // Structs that can be read directly from a Lua table are extracted first, starting
+        // from the back so that removing them from the stack does not change the position
+        // of the other arguments
+        for (size_t i = f->arguments.size(); i > 0; i--) {
+            if (!directLuaArgument(f, i - 1)) {
+                continue;
+            }
+
+            Variable* var = f->arguments[i - 1];
+            std::format_to(
+                std::back_inserter(result),
+                "        {0} {1} = codegen::internal::luaBake<{0}>(L, {2});\n"
+                "        lua_remove(L, {2});\n",
+                generateTypename(var->type), var->name, i
+            );
+            arguments.erase(std::find(arguments.begin(), arguments.end(), var));
+        }
+
         if (!arguments.empty()) {
             std::string names;
             std::string types;
@@ -958,7 +1804,8 @@ namespace {
             names = names.substr(0, names.size() - 2);
             types = types.substr(0, types.size() - 2);
 
-            result += std::format(
+            std::format_to(
+                std::back_inserter(result),
                 "        auto [{}] = ghoul::lua::values<{}>(L);\n", names, types
             );
         }
@@ -968,18 +1815,21 @@ namespace {
         // Depending on if there is a return value, we want to be able to capture it
         result += "            ";
         if (f->returnValue) {
-            result += std::format("{} res = ", generateTypename(f->returnValue));
+            std::format_to(
+                std::back_inserter(result),
+                "{} res = ", generateTypename(f->returnValue)
+            );
         }
 
         if (f->arguments.empty()) {
             // If there are no arguments to the function, it's pretty simple to just call
             // it
-            result += std::format("{}();\n", f->functionName);
+            std::format_to(std::back_inserter(result), "{}();\n", f->functionName);
         }
         else {
             // If there are arguments it might get a bit more complicated since we want to
             // support default initialized arguments
-            result += std::format("{}(\n", f->functionName);
+            std::format_to(std::back_inserter(result), "{}(\n", f->functionName);
 
             for (size_t i = 0; i < f->arguments.size(); i += 1) {
                 Variable* var = f->arguments[i];
@@ -998,21 +1848,26 @@ namespace {
                     // An alternative way would be to not provide the optional argument at
                     // all, but that turned out to be much more code and more complicated
                     // than just storing the default value
-                    result += std::format(
+                    std::format_to(
+                        std::back_inserter(result),
                         "{0}.has_value() ? std::move(*{0}) : {1}",
                         var->name, *ot->defaultArgument
                     );
                 }
-                else if (var->type->containsCustomType()) {
+                else if (var->type->containsCustomType() && !directLuaArgument(f, i)) {
                     // We have extracted this type as a ghoul::Dictionary previously, and
                     // need to bake it into the correct type here instead
-                    result += std::format(
+                    std::format_to(
+                        std::back_inserter(result),
                         "codegen::bake<{0}>({1})",
                         generateTypename(var->type), var->name
                     );
                 }
                 else {
-                    result += std::format("std::move({})", var->name);
+                    std::format_to(
+                        std::back_inserter(result),
+                        "std::move({})", var->name
+                    );
                 }
 
                 if (i != f->arguments.size() - 1) {
@@ -1025,12 +1880,19 @@ namespace {
 
         if (f->returnValue) {
             if (f->returnValue->isOptionalType()) {
-                result += LuaWrapperPushOptional;
+                OptionalType* ot = static_cast<OptionalType*>(f->returnValue);
+                std::format_to(
+                    std::back_inserter(result),
+                    LuaWrapperPushOptional, luaPushFunction(ot->type)
+                );
             }
             else if (f->returnValue->isVariantType()) {
                 VariantType* vt = static_cast<VariantType*>(f->returnValue);
                 for (VariableType* v : vt->types) {
-                    result += std::format(LuaWrapperPushVariant, generateTypename(v));
+                    std::format_to(
+                        std::back_inserter(result),
+                        LuaWrapperPushVariant, generateTypename(v), luaPushFunction(v)
+                    );
                 }
                 result += "            return 1;\n";
             }
@@ -1039,17 +1901,7 @@ namespace {
 
                 switch (vt->type->type) {
                     case StackElement::Type::Struct: {
-                        const Struct* s = static_cast<const Struct*>(vt->type);
-
-                        result += "            lua_newtable(L);\n";
-                        for (Variable* var : s->variables) {
-                            result += std::format(
-                                "            ghoul::lua::push(L, \"{0}\", std::move(res.{0}));\n",
-                                var->name
-                            );
-                            result += "            lua_settable(L, -3);\n";
-                        }
-                        result += '\n';
+                        result += "            codegen::internal::luaPush(L, std::move(res));\n";
                         result += "            return 1;\n";
                         break;
                     }
@@ -1061,7 +1913,10 @@ namespace {
                 }
             }
             else {
-                result += "            ghoul::lua::push(L, std::move(res));\n";
+                std::format_to(
+                    std::back_inserter(result),
+                    "            {}(L, std::move(res));\n", luaPushFunction(f->returnValue)
+                );
                 result += "            return 1;\n";
             }
         }
@@ -1078,9 +1933,10 @@ namespace {
 
 
         // Argument description
-        std::string argumentsDesc = "{\n";
+        result += "    {\n";
         for (Variable* var : f->arguments) {
-            argumentsDesc += std::format(
+            std::format_to(
+                std::back_inserter(result),
                 R"(        {{ "{}", "{}")",
                 var->name, generateDescriptiveTypename(var->type)
             );
@@ -1100,37 +1956,49 @@ namespace {
                         i -= 1;
                     }
                 }
-                argumentsDesc += std::format(", \"{}\"", defaultArgument);
+                std::format_to(
+                    std::back_inserter(result),
+                    ", \"{}\"", defaultArgument
+                );
             }
 
-            argumentsDesc += " },\n";
+            result += " },\n";
 
         }
         if (!f->arguments.empty()) {
             // Remove the closing ", "
-            argumentsDesc = argumentsDesc.substr(0, argumentsDesc.size() - 1);
+            result.pop_back();
         }
 
-        result += "    " + argumentsDesc + "\n    },\n";
+        result += "\n    },\n";
 
-        result += std::format(
+        std::format_to(
+            std::back_inserter(result),
             "    \"{}\",\n",
             f->returnValue ? generateDescriptiveTypename(f->returnValue) : ""
         );
 
         // Documentation
-        result += std::format(R"(    R"[({})[")", f->documentation) + ",\n";
+        std::format_to(
+            std::back_inserter(result),
+            R"(    R"[({})[")", f->documentation
+        );
+        result += ",\n";
 
         // Source location
         if (f->sourceLocation.file.empty()) {
             // The `sourceLocation.file` is empty for all of the unit tests where we call
             // the `parse` function manually, so that not filename exists
-            result += std::format("    {{ \"<null>\", {} }}\n", f->sourceLocation.line);
+            std::format_to(
+                std::back_inserter(result),
+                "    {{ \"<null>\", {} }}\n", f->sourceLocation.line
+            );
         }
         else {
             // `sourceLocation.file` is the full path to the file, but we only want to
             // store the path relative to the working directory
-            result += std::format(
+            std::format_to(
+                std::back_inserter(result),
                 "    {{ \"{}\", {} }}\n",
                 f->sourceLocation.file.string(), f->sourceLocation.line
             );
@@ -1138,16 +2006,13 @@ namespace {
 
         result += "};\n\n";
 
-        return result;
     }
 
-    std::string generateLuaWrapperResult(const Code& code, HeaderInfo&) {
+    void generateLuaWrapperResult(std::string& result, const Code& code) {
         if (code.luaWrapperFunctions.empty()) {
-            return "";
+            return;
         }
 
-        std::string result;
-
         // The Lua wrapping functions require a bit more of the conversions, like being
         // able to return them wrapped in an optional, vector, etc, so we need to enhance
         // the `bake` function to be able to take care of those types if they arise
@@ -1188,136 +2053,427 @@ namespace {
             result += "} // namespace codegen\n\n";
         }
 
+        std::vector<const Struct*> readStructs = directLuaStructs(code);
+        std::vector<const Struct*> pushStructs;
+        for (const Function* f : code.luaWrapperFunctions) {
+            if (f->returnValue) {
+                collectLuaPushStructs(f->returnValue, pushStructs);
+            }
+        }
+
+        if (!readStructs.empty() || !pushStructs.empty()) {
+            result += "namespace codegen::internal {\n";
+        }
+
+        if (!readStructs.empty()) {
+            result += LuaBakeFunctions;
+            for (const Struct* s : readStructs) {
+                std::string condition;
+                for (const Variable* var : s->variables) {
+                    condition += " &&\n        ";
+                    condition += luaBakeExpression(var);
+                }
+
+                std::format_to(
+                    std::back_inserter(result),
+                    LuaBakeStruct,
+                    s->name, condition
+                );
+            }
+        }
+
+        if (!pushStructs.empty()) {
+            // The overloads for all structs have to be declared before the templates are
+            // defined, as they are not found through argument-dependent lookup
+            result += LuaPushFunctionDeclarations;
+            for (const Struct* s : pushStructs) {
+                std::format_to(
+                    std::back_inserter(result),
+                    "[[maybe_unused]] void luaPush(lua_State* L, {}&& value);\n",
+                    fqn(s, "::")
+                );
+            }
+
+            result += LuaPushFunctions;
+            for (const Struct* s : pushStructs) {
+                std::format_to(
+                    std::back_inserter(result),
+                    "\n[[maybe_unused]] void luaPush(lua_State* L, {}&& value) {{\n"
+                    "    lua_createtable(L, 0, {});\n",
+                    fqn(s, "::"), s->variables.size()
+                );
+                for (const Variable* var : s->variables) {
+                    std::format_to(
+                        std::back_inserter(result),
+                        "    {0}(L, std::move(value.{1}));\n"
+                        "    lua_setfield(L, -2, \"{1}\");\n",
+                        luaPushFunction(var->type), var->name
+                    );
+                }
+                result += "}\n";
+            }
+        }
+
+        if (!readStructs.empty() || !pushStructs.empty()) {
+            result += "} // namespace codegen::internal\n\n";
+        }
+
         result += "namespace codegen::lua {\n\n";
 
         for (Function* f : code.luaWrapperFunctions) {
-            result += generateLuaFunction(f);
+            generateLuaFunction(result, f);
         }
 
         result += "} // namespace codegen::lua\n";
-        return result;
     }
 
-    std::string createClickableFileName(std::string filename) {
-        for (size_t i = 0; i < filename.size(); i++) {
-            if (filename[i] == '\\') {
-                filename.insert(filename.begin() + i, '\\');
-                i += 1;
-            }
+    // Determines which of the fallback functions have to be written into the header of
+    // the generated file, which has to be known before any of the content is written
+    HeaderInfo headerInfo(const Code& code, const std::vector<const VariableType*>& types)
+    {
+        HeaderInfo info;
+
+        for (const Enum* e : code.enums) {
+            info.needsToStringFallback = true;
+            info.needsFromStringFallback = true;
+            info.needsBakeEnumFallback = true;
+            info.needsMappingFallback |= !e->attributes.mappedTo.empty();
+            info.needsArrayifyFallback |= e->attributes.arrayify;
         }
-        return filename;
-    }
-} // namespace
 
-std::string generateResult(const Code& code) {
-    assert(
-        !code.structs.empty() ||
-        !code.enums.empty() ||
-        !code.luaWrapperFunctions.empty()
-    );
+        for (const Struct* s : code.structs) {
+            info.needsMappingFallback |= !mappedEnums(*s).empty();
+        }
+        info.needsSerializeFunctions = std::any_of(
+            code.structs.begin(), code.structs.end(),
+            [](const Struct* s) { return s->attributes.serialize; }
+        );
+        info.needsBakeMany = std::any_of(
+            code.structs.begin(), code.structs.end(),
+            [](const Struct* s) { return s->attributes.bakeMany; }
+        );
 
-    HeaderInfo info;
-    std::string structs = generateStructsResult(code, info);
-    std::string enums = generateEnumResult(code, info);
-    std::string luaWrapper = generateLuaWrapperResult(code, info);
+        for (const VariableType* t : types) {
+            if (t->isMapType() && static_cast<const MapType*>(t)->hasEnumKey()) {
+                info.needsFromStringFallback = true;
+            }
+            info.needsKeyFormatting |= t->isVectorType() || t->isArrayType();
+        }
 
-    std::string header;
-    if (info.needsAny()) {
-        header += "namespace codegen {\n";
+        return info;
+    }
 
-        if (info.needsArrayifyFallback) {
-            header += std::format("{}\n", ArrayifyFallback);
+    // Returns a rough upper estimate for the size of the generated file so that the
+    // buffer only needs to be allocated once for most files
+    size_t estimatedResultSize(const Code& code) {
+        // The file header and all fallback functions
+        size_t size = 8 * 1024;
+
+        auto structSize = [](auto& self, const Struct* s) -> size_t {
+            size_t res = 1024 + 512 * s->variables.size();
+            for (const StackElement* e : s->children) {
+                if (e->type == StackElement::Type::Struct) {
+                    res += self(self, static_cast<const Struct*>(e));
+                }
+                else {
+                    res += 256 * static_cast<const Enum*>(e)->elements.size();
+                }
+            }
+            return res;
+        };
+
+        if (!code.structs.empty()) {
+            // The bake functions for the used types
+            size += 16 * 1024;
         }
-        if (info.needsMappingFallback) {
-            header += std::format("{}\n", MapFunctionFallback);
+        for (const Struct* s : code.structs) {
+            size += structSize(structSize, s);
         }
-        if (info.needsBakeEnumFallback) {
-            header += std::format("{}\n", BakeEnumFallback);
+        for (const Enum* e : code.enums) {
+            size += 1024 + 256 * e->elements.size();
         }
-        if (info.needsToStringFallback) {
-            header += std::format("{}\n", ToStringFallback);
+        for (const Function* f : code.luaWrapperFunctions) {
+            size += 1024 + 256 * f->arguments.size() + f->documentation.size();
         }
-        if (info.needsFromStringFallback) {
-            header += std::format("{}\n", FromStringFallback);
+        return size;
+    }
+
+    std::string createClickableFileName(std::string filename) {
+        for (size_t i = 0; i < filename.size(); i++) {
+            if (filename[i] == '\\') {
+                filename.insert(filename.begin() + i, '\\');
+                i += 1;
+            }
         }
-        header += "} // namespace codegen\n";
+        return filename;
     }
 
-    // GCC has an overeager need to report an uninitialized variable when returning
-    // a std::variant<std::string, ghoul::Dictionary> in a Lua function
-    constexpr std::string_view GCCWarningStart =
+    // Generates the code for the `types` that are used by the `code` and its header
+    // information `info`, which have to be determined first
+    std::string writeResult(const Code& code,
+                            const std::vector<const VariableType*>& types,
+                            const HeaderInfo& info)
+    {
+        assert(
+            !code.structs.empty() ||
+            !code.enums.empty() ||
+            !code.luaWrapperFunctions.empty()
+        );
+
+        // GCC has an overeager need to report an uninitialized variable when returning
+        // a std::variant<std::string, ghoul::Dictionary> in a Lua function
+        constexpr std::string_view GCCWarningStart =
 #if defined(__GNUC__) && !defined(__clang__)
-        "#pragma GCC diagnostic push\n"
-        "#pragma GCC diagnostic ignored \"-Wmaybe-uninitialized\"\n";
+            "#pragma GCC diagnostic push\n"
+            "#pragma GCC diagnostic ignored \"-Wmaybe-uninitialized\"\n";
 #else
-        "";
+            "";
 #endif
-    constexpr std::string_view GCCWarningEnd =
+        constexpr std::string_view GCCWarningEnd =
 #if defined(__GNUC__) && !defined(__clang__)
-        "#pragma GCC diagnostic pop\n";
+            "#pragma GCC diagnostic pop\n";
 #else
-        "";
+            "";
 #endif
 
-    // The reversal in the arguments here is on purpose. The alternative to this would be
-    // to first figure out whether we need to write the headers or not and that became
-    // quite cumbersome. So instead we now mark whenever someone needs it and we prepend
-    // it in this step
-    return std::format(
-        "{}{}\nnamespace {{\n{}{}{}{}\n}} // namespace\n{}",
-        FileHeader, GCCWarningStart, header, enums, structs, luaWrapper, GCCWarningEnd
-    );
-}
+        // All parts are written into the same buffer in the order in which they appear in
+        // the file, so each byte is only written once
+        std::string result;
+        result.reserve(estimatedResultSize(code));
 
-Result handleFile(const std::filesystem::path& path) {
-    std::ifstream file = std::ifstream(path);
-    const std::string res = std::string(std::istreambuf_iterator<char>(file), {});
-    file.close();
+        result += FileHeader;
+        if (info.needsKeyFormatting) {
+            result += KeyFormattingInclude;
+        }
+        if (info.needsSerializeFunctions) {
+            result += SerializeFunctionsInclude;
+        }
+        if (info.needsBakeMany) {
+            result += BakeManyInclude;
+        }
+        result += GCCWarningStart;
+        result += "\nnamespace {\n";
 
+        if (info.needsAny()) {
+            result += "namespace codegen {\n";
 
-    Code code = parse(res, path);
-    if (code.structs.empty() && code.enums.empty() && code.luaWrapperFunctions.empty()) {
-        return Result::NotProcessed;
-    }
-    code.sourceFile = createClickableFileName(path.string());
+            if (info.needsArrayifyFallback) {
+                result += ArrayifyFallback;
+                result += '\n';
+            }
+            if (info.needsMappingFallback) {
+                result += MapFunctionFallback;
+                result += '\n';
+            }
+            if (info.needsBakeEnumFallback) {
+                result += BakeEnumFallback;
+                result += '\n';
+            }
+            if (info.needsToStringFallback) {
+                result += ToStringFallback;
+                result += '\n';
+            }
+            if (info.needsFromStringFallback) {
+                result += FromStringFallback;
+                result += '\n';
+            }
+            result += "} // namespace codegen\n";
+        }
 
-    std::string content = generateResult(code);
-    if (content.empty()) {
-        return Result::NotProcessed;
+        generateEnumResult(result, code);
+        generateStructsResult(result, code, types);
+        generateLuaWrapperResult(result, code);
+
+        result += "\n} // namespace\n";
+        result += GCCWarningEnd;
+        return result;
     }
+} // namespace
+
+std::string generateResult(const Code& code) {
+    const std::vector<const VariableType*> types = usedTypes(code.structs);
+    return writeResult(code, types, headerInfo(code, types));
+}
 
+std::filesystem::path destinationPath(const std::filesystem::path& path) {
     std::filesystem::path destination = path;
     destination.replace_extension();
     destination.replace_filename(destination.filename().string() + "_codegen.cpp");
+    return destination;
+}
 
-    bool shouldWriteFile = true;
-    if (std::filesystem::exists(destination)) {
-        std::ifstream f = std::ifstream(destination);
-        const std::string prev = std::string(std::istreambuf_iterator<char>{f}, {});
-        shouldWriteFile = (prev != content);
+namespace {
+    MappedFile readFile(const std::filesystem::path& path, Profile* profile,
+                        bool allowMapping)
+    {
+        ProfileScope scope(profile, path, "read");
+        return MappedFile(path, allowMapping);
     }
 
-    if (shouldWriteFile) {
-        if constexpr (PreventFileChange) {
-            throw CodegenError(std::format("File '{}' changed", path.filename()));
+    Result processFile(const std::filesystem::path& path, std::string_view res,
+                       Statistics* statistics, Profile* profile)
+    {
+        // Most files don't contain any codegen markers, so we can reject them here
+        // before doing any of the more expensive parsing
+        bool hasMarker = false;
+        {
+            ProfileScope scope(profile, path, "prefilter");
+            hasMarker = containsCodegenMarker(res);
+        }
+        if (statistics) {
+            statistics->nPrefilteredFiles++;
+            if (hasMarker) {
+                statistics->nPrefilterHits++;
+            }
+        }
+        if (!hasMarker) {
+            return Result::NotProcessed;
+        }
+
+        Code code;
+        {
+            ProfileScope scope(profile, path, "parse");
+            code = parse(res, path);
+        }
+        if (code.structs.empty() && code.enums.empty() &&
+            code.luaWrapperFunctions.empty())
+        {
+            return Result::NotProcessed;
+        }
+        code.sourceFile = createClickableFileName(path.string());
+
+        std::vector<const VariableType*> types;
+        HeaderInfo info;
+        {
+            ProfileScope scope(profile, path, "types");
+            types = usedTypes(code.structs);
+            info = headerInfo(code, types);
+        }
+
+        std::string content;
+        {
+            ProfileScope scope(profile, path, "generate");
+            content = writeResult(code, types, info);
+        }
+        if (content.empty()) {
+            return Result::NotProcessed;
+        }
+
+        const std::filesystem::path destination = destinationPath(path);
+
+        bool shouldWriteFile = true;
+        {
+            ProfileScope scope(profile, path, "compare");
+            if (std::filesystem::exists(destination)) {
+                const MappedFile prev = MappedFile(destination);
+                shouldWriteFile = (prev.content != content);
+            }
+        }
+
+        if (shouldWriteFile) {
+            if constexpr (PreventFileChange) {
+                throw CodegenError(std::format("File '{}' changed", path.filename()));
+            }
+        }
+
+        std::filesystem::path debugDest = destination;
+        debugDest.replace_extension();
+        debugDest.replace_filename(debugDest.filename().string() + "_debug.cpp");
+
+        if (shouldWriteFile || ShouldAlwaysWriteFiles) {
+            ProfileScope scope(profile, path, "write");
+            std::cout << std::format("Processed file '{}'\n", path.filename());
+
+            // Writing in binary mode so that the file content is exactly the same as what
+            // we compare against the next time around. The content is written to a
+            // temporary file first and then moved into place so that a compiler that runs
+            // at the same time (for example while watching) never sees a partial file.
+            // The name of the temporary file is unique for each thread, as the same file
+            // might be generated by multiple processes at the same time
+            thread_local const std::string TmpSuffix = std::format(
+                ".{:08x}{:08x}.tmp", std::random_device()(), std::random_device()()
+            );
+            std::filesystem::path tmp = destination;
+            tmp += TmpSuffix;
+
+            std::error_code ec;
+            {
+                std::ofstream r(tmp, std::ofstream::binary);
+                r.write(content.data(), content.size());
+                // Closing the file flushes the content, which might fail for example if
+                // the disk is full, so we have to check afterwards
+                r.close();
+                if (!r) {
+                    std::filesystem::remove(tmp, ec);
+                    throw CodegenError(std::format(
+                        "Could not write file '{}'", destination.string()
+                    ));
+                }
+            }
+
+            std::filesystem::rename(tmp, destination, ec);
+            if (ec) {
+                std::filesystem::remove(tmp, ec);
+                throw CodegenError(std::format(
+                    "Could not write file '{}'", destination.string()
+                ));
+            }
+
+            std::filesystem::remove(debugDest);
+            return Result::Processed;
+        }
+        else {
+            std::filesystem::remove(debugDest);
+            return Result::Skipped;
         }
     }
+} // namespace
 
-    std::filesystem::path debugDest = destination;
-    debugDest.replace_extension();
-    debugDest.replace_filename(debugDest.filename().string() + "_debug.cpp");
+Result handleFile(const std::filesystem::path& path, Cache* cache,
+                  Statistics* statistics, Profile* profile, bool allowMapping)
+{
+    ProfileScope scope(profile, path, "file");
 
-    if (shouldWriteFile || ShouldAlwaysWriteFiles) {
-        std::cout << std::format("Processed file '{}'\n", path.filename());
+    if (!cache || ShouldAlwaysWriteFiles) {
+        const MappedFile file = readFile(path, profile, allowMapping);
+        return processFile(path, file.content, statistics, profile);
+    }
 
-        std::ofstream r(destination);
-        r.write(content.data(), content.size());
+    Cache::Entry entry;
+    entry.size = std::filesystem::file_size(path);
+    entry.modificationTime =
+        std::filesystem::last_write_time(path).time_since_epoch().count();
+
+    // A cached entry is only valid if the generated file has not been removed since
+    const std::optional<Cache::Entry> prev = cacheEntry(*cache, path);
+    const bool isPrevValid =
+        prev.has_value() && prev->size == entry.size &&
+        (!prev->hasOutput || std::filesystem::exists(destinationPath(path)));
+
+    if (isPrevValid && prev->modificationTime == entry.modificationTime) {
+        // The file has not been touched since the last time, so we don't even need to
+        // look at the content
+        return prev->hasOutput ? Result::Skipped : Result::NotProcessed;
+    }
 
-        std::filesystem::remove(debugDest);
-        return Result::Processed;
+    const MappedFile file = readFile(path, profile, allowMapping);
+    {
+        // The file is mapped lazily, so hashing the content is what actually reads it
+        ProfileScope readScope(profile, path, "read");
+        entry.contentHash = hashContent(file.content);
     }
-    else {
-        std::filesystem::remove(debugDest);
-        return Result::Skipped;
+    if (isPrevValid && prev->contentHash == entry.contentHash) {
+        // The file was touched, but the content is the same as before
+        entry.hasOutput = prev->hasOutput;
+        updateCacheEntry(*cache, path, entry);
+        return prev->hasOutput ? Result::Skipped : Result::NotProcessed;
     }
+
+    // Remove the entry first so that a file that fails to process does not leave an old
+    // entry behind
+    removeCacheEntry(*cache, path);
+    const Result result = processFile(path, file.content, statistics, profile);
+    entry.hasOutput = (result != Result::NotProcessed);
+    updateCacheEntry(*cache, path, entry);
+    return result;
 }
@@ -25,6 +25,7 @@
 #ifndef __OPENSPACE_CODEGEN___CODEGEN___H__
 #define __OPENSPACE_CODEGEN___CODEGEN___H__
 
+#include <atomic>
 #include <filesystem>
 #include <string>
 
@@ -34,9 +35,37 @@ enum class Result {
     Skipped
 };
 
+struct Cache;
 struct Code;
+struct Profile;
 
-Result handleFile(const std::filesystem::path& path);
+struct Statistics {
+    // The number of files whose content was inspected by the prefilter
+    std::atomic<int> nPrefilteredFiles = 0;
+    // The number of inspected files that contained at least one codegen marker
+    std::atomic<int> nPrefilterHits = 0;
+};
+
+/**
+ * Generates the `_codegen.cpp` file for the source file at \p path. If a \p cache is
+ * provided, files whose size and modification time or content hash match the cached
+ * information are not parsed at all and the \p cache is updated with the new
+ * information otherwise. Files that do not contain any codegen marker are rejected
+ * before they are parsed. If \p statistics is provided, it is updated with information
+ * about the handled file. If \p profile is provided, the time spent in each phase of
+ * handling the file is added to it. If \p allowMapping is `false`, the source file is
+ * read into memory instead of being memory-mapped, which is needed if the file might be
+ * truncated while it is handled.
+ */
+Result handleFile(const std::filesystem::path& path, Cache* cache = nullptr,
+    Statistics* statistics = nullptr, Profile* profile = nullptr,
+    bool allowMapping = true);
 std::string generateResult(const Code& code);
 
+/**
+ * Returns the path of the `_codegen.cpp` file that is generated for the source file at
+ * \p path.
+ */
+std::filesystem::path destinationPath(const std::filesystem::path& path);
+
 #endif // __OPENSPACE_CODEGEN___CODEGEN___H__
@@ -30,6 +30,9 @@
 
 namespace keywords {
 
+// Every codegen attribute starts with this prefix
+constexpr std::string_view Prefix = "[[codegen::";
+
 constexpr std::string_view Verbatim = "verbatim";
 constexpr std::string_view Dictionary = "Dictionary";
 constexpr std::string_view Enum = "enum";
@@ -37,6 +40,7 @@ constexpr std::string_view Stringify = "stringify";
 constexpr std::string_view Map = "map";
 constexpr std::string_view LuaWrap = "luawrap";
 constexpr std::string_view Arrayify = "arrayify";
+constexpr std::string_view Constexpr = "constexpr";
 
 constexpr std::string_view Annotation = "annotation";
 constexpr std::string_view Color = "color";
@@ -60,6 +64,9 @@ constexpr std::string_view Key = "key";
 constexpr std::string_view Private = "private";
 
 constexpr std::string_view NoExhaustive = "noexhaustive";
+constexpr std::string_view FusedBake = "fusedbake";
+constexpr std::string_view BakeMany = "bakemany";
+constexpr std::string_view Serialize = "serialize";
 constexpr std::string_view MustBeNotEmpty = "notempty";
 
 } // namespace keywords
@@ -72,7 +79,7 @@ constexpr std::string_view MustBeNotEmpty = "notempty";
 constexpr std::pair<size_t, size_t> findKeyword(std::string_view text,
                                                 std::string_view keyword)
 {
-    constexpr std::string_view Prefix = "[[codegen::";
+    using keywords::Prefix;
 
     const size_t prefixIdx = text.find(Prefix);
     const size_t kwdIdx = text.find(keyword, prefixIdx);
@@ -0,0 +1,120 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include "mappedfile.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else // ^^^^ WIN32 // !WIN32 vvvv
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // WIN32
+
+namespace {
+    void* mapFile(const std::filesystem::path& path, size_t size) {
+#ifdef WIN32
+        HANDLE file = CreateFileW(
+            path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+            nullptr
+        );
+        if (file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) {
+            return nullptr;
+        }
+        void* res = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+        // The view keeps a reference to the mapping, so we can close the handle already
+        CloseHandle(mapping);
+        return res;
+#else // ^^^^ WIN32 // !WIN32 vvvv
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            return nullptr;
+        }
+        void* res = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping stays valid after the file descriptor is closed
+        close(fd);
+        if (res == MAP_FAILED) {
+            return nullptr;
+        }
+        madvise(res, size, MADV_SEQUENTIAL);
+        return res;
+#endif // WIN32
+    }
+
+    void unmapFile(void* mapping, [[maybe_unused]] size_t size) {
+#ifdef WIN32
+        UnmapViewOfFile(mapping);
+#else // ^^^^ WIN32 // !WIN32 vvvv
+        munmap(mapping, size);
+#endif // WIN32
+    }
+} // namespace
+
+MappedFile::MappedFile(const std::filesystem::path& path, bool allowMapping) {
+    std::error_code ec;
+    const uintmax_t size = std::filesystem::file_size(path, ec);
+    if (ec || size == 0) {
+        // Mapping an empty file is not allowed, but there is nothing to read anyway
+        return;
+    }
+
+    mapping = allowMapping ? mapFile(path, static_cast<size_t>(size)) : nullptr;
+    if (mapping) {
+        mappingSize = static_cast<size_t>(size);
+        content = std::string_view(static_cast<const char*>(mapping), mappingSize);
+        return;
+    }
+
+    // The mapping failed or was not allowed, so we read the entire file in one go
+    std::ifstream file = std::ifstream(path, std::ifstream::binary);
+    buffer.resize(static_cast<size_t>(size));
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.resize(static_cast<size_t>(file.gcount()));
+    content = buffer;
+}
+
+MappedFile::~MappedFile() {
+    if (mapping) {
+        unmapFile(mapping, mappingSize);
+    }
+}
@@ -0,0 +1,59 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CODEGEN___MAPPEDFILE___H__
+#define __OPENSPACE_CODEGEN___MAPPEDFILE___H__
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+/**
+ * Provides read-only access to the content of a file. Where possible, the file is
+ * memory-mapped so that the content can be used directly from the mapped pages without
+ * any copying. If the mapping fails, the entire file is read into a buffer in one bulk
+ * read instead. In both cases, the `content` is valid for the lifetime of this object.
+ *
+ * If \p allowMapping is `false`, the file is always read into the buffer. This has to be
+ * used for files that might be truncated by another process while they are in use, as
+ * accessing the pages of a mapped file beyond its new end raises a `SIGBUS` signal.
+ */
+struct MappedFile {
+    explicit MappedFile(const std::filesystem::path& path, bool allowMapping = true);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view content;
+
+    // Implementation details. `mapping` is the address of the mapped memory if the file
+    // was mapped or `nullptr` if the `buffer` is used instead
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+    std::string buffer;
+};
+
+#endif // __OPENSPACE_CODEGEN___MAPPEDFILE___H__
@@ -35,6 +35,7 @@
 #include <format>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -413,10 +414,10 @@ namespace {
         return res;
     }
 
-    Struct* parseStruct(std::string_view line) {
+    Struct* parseStruct(std::string_view line, Arena& arena) {
         assert(!line.empty());
 
-        Struct* s = new Struct;
+        Struct* s = arena.create<Struct>();
 
         size_t cursor = line.find(' ');
         assert(line.substr(0, cursor) == "struct");
@@ -435,6 +436,15 @@ namespace {
                 else if (a.key == keywords::NoExhaustive) {
                     s->attributes.noExhaustive = (a.value == "true" || a.value.empty());
                 }
+                else if (a.key == keywords::FusedBake) {
+                    s->attributes.fusedBake = (a.value == "true" || a.value.empty());
+                }
+                else if (a.key == keywords::BakeMany) {
+                    s->attributes.bakeMany = (a.value == "true" || a.value.empty());
+                }
+                else if (a.key == keywords::Serialize) {
+                    s->attributes.serialize = (a.value == "true" || a.value.empty());
+                }
                 else {
                     throw CodegenError(std::format(
                         "Unknown attribute '{}' in struct definition found\n{}",
@@ -468,10 +478,10 @@ namespace {
         return s;
     }
 
-    Enum* parseEnum(std::string_view line) {
+    Enum* parseEnum(std::string_view line, Arena& arena) {
         assert(!line.empty());
 
-        Enum* e = new Enum;
+        Enum* e = arena.create<Enum>();
 
         size_t cursor = line.find(' ', line.find(' ') + 1);
         assert(line.substr(0, cursor) == "enum class");
@@ -499,6 +509,9 @@ namespace {
                 else if (a.key == keywords::Arrayify) {
                     e->attributes.arrayify = true;
                 }
+                else if (a.key == keywords::Constexpr) {
+                    e->attributes.isConstexpr = true;
+                }
                 else {
                     throw CodegenError(std::format(
                         "Unknown attribute '{}' in enum definition found\n{}",
@@ -518,10 +531,10 @@ namespace {
         return e;
     }
 
-    EnumElement* parseEnumElement(std::string_view line) {
+    EnumElement* parseEnumElement(std::string_view line, Arena& arena) {
         assert(!line.empty());
 
-        EnumElement* e = new EnumElement;
+        EnumElement* e = arena.create<EnumElement>();
 
         if (line.back() == ',') {
             line.remove_suffix(1);
@@ -550,7 +563,7 @@ namespace {
         return e;
     }
 
-    Variable* parseVariable(std::string_view line, Struct* s) {
+    Variable* parseVariable(std::string_view line, Struct* s, Arena& arena) {
         assert(!line.empty());
 
         // Remove the trailing ;
@@ -603,10 +616,10 @@ namespace {
             ));
         }
 
-        Variable* res = new Variable;
+        Variable* res = arena.create<Variable>();
 
         const std::string_view typeString = line.substr(0, p1);
-        res->type = parseType(typeString, s);
+        res->type = parseType(typeString, s, arena);
 
         if (res->type->isPointerType()) {
             throw CodegenError(std::format(
@@ -634,176 +647,309 @@ namespace {
         return res;
     }
 
-    std::pair<size_t, size_t> validStructCode(std::string_view code) {
-        assert(!code.empty());
-
-        const size_t loc = findKeyword(code, keywords::Dictionary).first;
-        if (loc == std::string_view::npos) {
-            // We did't find the attribute
-            return { std::string_view::npos, std::string_view::npos };
-        }
-
-        size_t cursor = loc;
-        while (!code.substr(cursor, loc - cursor).contains("struct")) {
-            if (cursor == 0) {
-                std::string_view sb = code.substr(
-                    static_cast<size_t>(std::max(0, static_cast<int>(loc) - 50)),
-                    std::min<size_t>(50, code.size() - 1)
-                );
-                throw CodegenError(std::format(
-                    "Could not find 'struct' before '[[codegen::Dictionary' before "
-                    "reaching the end of the file\n{}",
-                    sb
-                ));
-            }
+    // A block of code that is annotated with one of the root codegen attributes
+    struct Marker {
+        enum class Type {
+            Struct,
+            Enum,
+            Function
+        };
+        Type type = Type::Struct;
+
+        // The end of the previous block. A comment preceding this block has to be located
+        // between this location and `begin`
+        size_t regionBegin = 0;
+        // The location of the first character of the block and the number of characters
+        size_t begin = 0;
+        size_t length = 0;
+        // The 1-based line number of the first character of the block
+        int line = 0;
+    };
 
-            cursor--;
-        }
+    // Finds the code blocks in a file in a single pass through the file. Comments, string
+    // literals, and character literals are skipped, so attributes or brackets contained
+    // in them are not considered
+    struct MarkerScanner {
+        std::string_view code;
+        // The location from which the search for the next marker continues
+        size_t cursor = 0;
+        size_t regionBegin = 0;
 
-        std::string_view nameCheck = code.substr(cursor, loc - cursor);
-        assert(startsWith(nameCheck, "struct"));
+        // The number of the line that `lineCursor` is located in
+        int line = 1;
+        size_t lineCursor = 0;
+    };
 
-        using namespace std::literals;
-        nameCheck.remove_prefix("struct"sv.size());
-        for (const char c : nameCheck) {
-            if (::isspace(c) == 0) {
-                throw CodegenError(std::format(
-                    "Only 'struct' can appear directly before [[codegen::Dictionary\n{}",
-                    code.substr(0, std::min<size_t>(code.size(), 50))
-                ));
-            }
-        }
+    bool isWordCharacter(char c) {
+        return ::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
+    }
 
-        const size_t lastNewLine = static_cast<size_t>(cursor);
-        cursor = code.find('{', lastNewLine) + 1;
-        for (int counter = 1; counter > 0; cursor++) {
-            if (cursor >= code.size()) {
-                throw CodegenError(std::format(
-                    "Could not find closing }} of root struct\n{}", code
-                ));
+    // Returns the location directly after the string or character literal starting at
+    // `cursor`. An unterminated literal ends at the end of the line
+    size_t skipLiteral(std::string_view code, size_t cursor) {
+        const char delimiter = code[cursor];
+        for (size_t i = cursor + 1; i < code.size(); i++) {
+            if (code[i] == '\\') {
+                i++;
             }
-
-            if (code[cursor] == '{') {
-                counter++;
+            else if (code[i] == delimiter) {
+                return i + 1;
             }
-            if (code[cursor] == '}') {
-                counter--;
+            else if (code[i] == '\n') {
+                return i;
             }
         }
-
-        return { lastNewLine, cursor - lastNewLine + 1 };
+        return code.size();
     }
 
-    std::pair<size_t, size_t> validEnumCode(std::string_view code) {
-        assert(!code.empty());
-
-        const size_t locEnum = findKeyword(code, keywords::Enum).first;
-        const size_t locStringify = findKeyword(code, keywords::Stringify).first;
-        const size_t locMap = findKeyword(code, keywords::Map).first;
-        const size_t locArray = findKeyword(code, keywords::Arrayify).first;
-        const size_t loc = std::min({ locEnum, locStringify, locMap, locArray });
-        if (loc == std::string_view::npos) {
-            // We didn't find the attribute
-            return { std::string_view::npos, std::string_view::npos };
+    // Returns the location directly after the raw string literal whose `"` is located at
+    // `cursor`
+    size_t skipRawLiteral(std::string_view code, size_t cursor) {
+        const size_t open = code.find('(', cursor);
+        if (open == std::string_view::npos) {
+            return code.size();
         }
+        const std::string_view delimiter = code.substr(cursor + 1, open - cursor - 1);
+        const std::string close = std::format("){}\"", delimiter);
+        const size_t p = code.find(close, open);
+        return p == std::string_view::npos ? code.size() : p + close.size();
+    }
 
-        int64_t cursor = loc;
-        while (code.substr(cursor, loc - cursor).find("enum class") ==
-               std::string_view::npos)
-        {
-            cursor--;
-
-            if (cursor < 0) {
-                std::string_view sb = code.substr(
-                    static_cast<size_t>(std::max(0, static_cast<int>(loc) - 50)),
-                    std::min<size_t>(50, code.size() - 1)
-                );
-                throw CodegenError(std::format(
-                    "Could not find 'enum class' before '[[codegen::stringify' before "
-                    "reaching the end of the file\n{}",
-                    sb
-                ));
+    // Returns the next block of code or std::nullopt if there are no more blocks. Each
+    // block starts with the first root attribute after the end of the previous block, so
+    // attributes inside a block, for example those of the struct members, are ignored
+    std::optional<Marker> nextMarker(MarkerScanner& scanner) {
+        using keywords::Prefix;
+        const std::string_view code = scanner.code;
+
+        std::optional<Marker> marker;
+        // The nesting depth of { } for structs and enums and ( ) for functions
+        int depth = 0;
+        bool hasOpened = false;
+
+        // The location of the last `struct` and `enum class` keywords in the region
+        size_t lastStruct = std::string_view::npos;
+        size_t lastEnum = std::string_view::npos;
+
+        // The beginning of the current identifier or number and whether it is a number.
+        // This is needed to distinguish digit separators from character literals
+        size_t wordBegin = std::string_view::npos;
+        bool isNumber = false;
+
+        size_t i = scanner.cursor;
+        while (i < code.size()) {
+            const char c = code[i];
+
+            if (isWordCharacter(c)) {
+                if (wordBegin == std::string_view::npos) {
+                    wordBegin = i;
+                    isNumber = ::isdigit(static_cast<unsigned char>(c)) != 0;
+
+                    const std::string_view word = code.substr(i);
+                    if (!marker && i >= scanner.regionBegin) {
+                        if (word.starts_with("struct") &&
+                            (word.size() == 6 || !isWordCharacter(word[6])))
+                        {
+                            lastStruct = i;
+                        }
+                        if (word.starts_with("enum class")) {
+                            lastEnum = i;
+                        }
+                    }
+                }
+                i++;
+                continue;
             }
-        }
-
-        std::string_view nameCheck = code.substr(cursor, loc - cursor);
-        assert(startsWith(nameCheck, "enum class"));
 
-        using namespace std::literals;
-        nameCheck.remove_prefix("enum class"sv.size());
-        for (const char c : nameCheck) {
-            if (::isspace(c) == 0) {
-                throw CodegenError(std::format(
-                    "Only 'enum class' can appear directly before "
-                    "[[codegen::stringify\n{}",
-                    code.substr(0, std::min<size_t>(code.size(), 50))
-                ));
+            if (c == '\'' && wordBegin != std::string_view::npos && isNumber) {
+                // A digit separator
+                i++;
+                continue;
             }
-        }
 
-        const size_t lastNewLine = static_cast<size_t>(cursor);
-        cursor = code.find('{', lastNewLine) + 1;
-        for (int counter = 1; counter > 0; cursor++) {
-            if (cursor >= static_cast<int64_t>(code.size())) {
-                throw CodegenError(std::format(
-                    "Could not find closing }} of root enum\n{}", code
-                ));
+            std::string_view word;
+            if (wordBegin != std::string_view::npos) {
+                word = code.substr(wordBegin, i - wordBegin);
+                wordBegin = std::string_view::npos;
             }
 
-            if (code[cursor] == '{') {
-                counter++;
+            if (c == '/' && i + 1 < code.size() && code[i + 1] == '/') {
+                const size_t p = code.find('\n', i);
+                i = (p == std::string_view::npos) ? code.size() : p;
+                continue;
             }
-            if (code[cursor] == '}') {
-                counter--;
+            if (c == '/' && i + 1 < code.size() && code[i + 1] == '*') {
+                const size_t p = code.find("*/", i + 2);
+                i = (p == std::string_view::npos) ? code.size() : p + 2;
+                continue;
+            }
+            if (c == '"' &&
+                (word == "R" || word == "u8R" || word == "uR" || word == "UR" ||
+                 word == "LR"))
+            {
+                i = skipRawLiteral(code, i);
+                continue;
+            }
+            if (c == '"' || c == '\'') {
+                i = skipLiteral(code, i);
+                continue;
             }
-        }
 
-        return { lastNewLine, cursor - lastNewLine + 1 };
-    }
+            if (!marker) {
+                if (c != '[' || i < scanner.regionBegin ||
+                    !code.substr(i).starts_with(Prefix))
+                {
+                    i++;
+                    continue;
+                }
+
+                const std::string_view region = code.substr(scanner.regionBegin);
+                const size_t loc = i - scanner.regionBegin;
+                const std::string_view kw = code.substr(i + Prefix.size());
+                Marker m;
+                m.regionBegin = scanner.regionBegin;
+                if (kw.starts_with(keywords::Dictionary)) {
+                    if (lastStruct == std::string_view::npos) {
+                        std::string_view sb = region.substr(
+                            static_cast<size_t>(std::max(0, static_cast<int>(loc) - 50)),
+                            std::min<size_t>(50, region.size() - 1)
+                        );
+                        throw CodegenError(std::format(
+                            "Could not find 'struct' before '[[codegen::Dictionary' "
+                            "before reaching the end of the file\n{}",
+                            sb
+                        ));
+                    }
 
-    std::pair<size_t, size_t> validFunctionCode(std::string_view code) {
-        assert(!code.empty());
+                    const size_t p = lastStruct + "struct"sv.size();
+                    const std::string_view between = code.substr(p, i - p);
+                    if (!isEmptyLine(between)) {
+                        throw CodegenError(std::format(
+                            "Only 'struct' can appear directly before "
+                            "[[codegen::Dictionary\n{}",
+                            region.substr(0, std::min<size_t>(region.size(), 50))
+                        ));
+                    }
 
-        const auto [beg, end] = findKeyword(code, keywords::LuaWrap);
-        if (beg == std::string_view::npos) {
-            // We didn't find the attribute
-            return { std::string_view::npos, std::string_view::npos };
-        }
+                    m.type = Marker::Type::Struct;
+                    m.begin = lastStruct;
+                }
+                else if (kw.starts_with(keywords::Enum) ||
+                         kw.starts_with(keywords::Stringify) ||
+                         kw.starts_with(keywords::Map) ||
+                         kw.starts_with(keywords::Arrayify))
+                {
+                    if (lastEnum == std::string_view::npos) {
+                        std::string_view sb = region.substr(
+                            static_cast<size_t>(std::max(0, static_cast<int>(loc) - 50)),
+                            std::min<size_t>(50, region.size() - 1)
+                        );
+                        throw CodegenError(std::format(
+                            "Could not find 'enum class' before '[[codegen::stringify' "
+                            "before reaching the end of the file\n{}",
+                            sb
+                        ));
+                    }
 
-        const size_t start = beg;
+                    const size_t p = lastEnum + "enum class"sv.size();
+                    const std::string_view between = code.substr(p, i - p);
+                    if (!isEmptyLine(between)) {
+                        throw CodegenError(std::format(
+                            "Only 'enum class' can appear directly before "
+                            "[[codegen::stringify\n{}",
+                            region.substr(0, std::min<size_t>(region.size(), 50))
+                        ));
+                    }
 
-        // Find the end of the attribute
-        size_t cursor = code.find(']', start) + 1;
+                    m.type = Marker::Type::Enum;
+                    m.begin = lastEnum;
+                }
+                else if (kw.starts_with(keywords::LuaWrap)) {
+                    m.type = Marker::Type::Function;
+                    m.begin = i;
+                }
+                else {
+                    // An attribute that does not start a block means that there is no
+                    // more code that we can handle
+                    scanner.cursor = code.size();
+                    return std::nullopt;
+                }
 
-        // We have to iterate until we find the first { character that is not contained in
-        // any parantheses. { } pairs in parantheses might be used for default
-        // initializing a function parameter
-        int nParantheses = 0;
-        while (true) {
-            if (cursor >= code.size()) {
-                throw CodegenError(std::format(
-                    "Illformed function definition at {}", code.substr(start, 50)
+                scanner.line += static_cast<int>(std::count(
+                    code.begin() + scanner.lineCursor, code.begin() + m.begin, '\n'
                 ));
-            }
+                scanner.lineCursor = m.begin;
+                m.line = scanner.line;
 
-            if (code[cursor] == '(') {
-                nParantheses += 1;
-            }
-            if (code[cursor] == ')') {
-                nParantheses -= 1;
+                marker = m;
+                i += Prefix.size();
+                continue;
             }
 
-            if (code[cursor] == '{' && nParantheses == 0) {
-                break;
+            // We are inside a block and are looking for its end
+            if (marker->type == Marker::Type::Function) {
+                // The function signature ends at the first { that is not contained in
+                // any parentheses. { } pairs in parentheses might be used for default
+                // initializing a function parameter
+                if (c == '(') {
+                    depth++;
+                }
+                else if (c == ')') {
+                    depth--;
+                }
+                else if (c == '{' && depth == 0) {
+                    marker->length = i + 1 - marker->begin;
+                    scanner.regionBegin = i + 1;
+                    scanner.cursor = i + 1;
+                    return marker;
+                }
+            }
+            else {
+                if (c == '{') {
+                    depth++;
+                    hasOpened = true;
+                }
+                else if (c == '}' && hasOpened) {
+                    depth--;
+                    if (depth == 0) {
+                        // The block includes the character after the closing bracket,
+                        // which usually is the ;
+                        marker->length = i + 2 - marker->begin;
+                        scanner.regionBegin = std::min(i + 2, code.size());
+                        scanner.cursor = i + 1;
+                        return marker;
+                    }
+                }
             }
+            i++;
+        }
 
-            cursor += 1;
+        scanner.cursor = code.size();
+        if (!marker) {
+            return std::nullopt;
         }
 
-        return { start, cursor + 1 - start };
+        switch (marker->type) {
+            case Marker::Type::Struct:
+                throw CodegenError(std::format(
+                    "Could not find closing }} of root struct\n{}",
+                    code.substr(marker->regionBegin)
+                ));
+            case Marker::Type::Enum:
+                throw CodegenError(std::format(
+                    "Could not find closing }} of root enum\n{}",
+                    code.substr(marker->regionBegin)
+                ));
+            case Marker::Type::Function:
+                throw CodegenError(std::format(
+                    "Illformed function definition at {}", code.substr(marker->begin, 50)
+                ));
+        }
+        throw CodegenError("Unhandled marker type");
     }
 
-    [[nodiscard]] Struct* parseRootStruct(std::string_view code, size_t begin, size_t end)
+    [[nodiscard]] Struct* parseRootStruct(std::string_view code, size_t begin, size_t end,
+                                          Arena& arena)
     {
         const std::string_view content = strip(code.substr(begin, end));
 
@@ -861,7 +1007,7 @@ namespace {
                         ));
                     }
 
-                    Struct* s = parseStruct(structBuffer);
+                    Struct* s = parseStruct(structBuffer, arena);
                     assert(s);
                     if (!stack.empty()) {
                         assert(stack.back()->type == StackElement::Type::Struct);
@@ -906,7 +1052,7 @@ namespace {
                     if (enumBuffer.empty()) {
                         // The header information started and finished in a single row
                         assert(!isCollectingHeader);
-                        e = parseEnum(line);
+                        e = parseEnum(line, arena);
                     }
                     else {
                         // We had to collect the header information over multiple rows; we
@@ -915,7 +1061,7 @@ namespace {
                         enumBuffer += ' ';
 
                         assert(isCollectingHeader);
-                        e = parseEnum(enumBuffer);
+                        e = parseEnum(enumBuffer, arena);
 
                         enumBuffer.clear();
                         isCollectingHeader = false;
@@ -964,7 +1110,7 @@ namespace {
                         Enum* e = static_cast<Enum*>(stack.back());
 
                         enumBuffer += line;
-                        EnumElement* el = parseEnumElement(enumBuffer);
+                        EnumElement* el = parseEnumElement(enumBuffer, arena);
                         assert(el);
                         enumBuffer.clear();
                         e->elements.push_back(el);
@@ -994,11 +1140,11 @@ namespace {
 
                     Variable* var = nullptr;
                     if (variableBuffer.empty()) {
-                        var = parseVariable(line, s);
+                        var = parseVariable(line, s, arena);
                     }
                     else {
                         variableBuffer += line;
-                        var = parseVariable(variableBuffer, s);
+                        var = parseVariable(variableBuffer, s, arena);
                         variableBuffer.clear();
                     }
                     assert(var);
@@ -1022,11 +1168,11 @@ namespace {
 
                     EnumElement* el = nullptr;
                     if (enumBuffer.empty()) {
-                        el = parseEnumElement(line);
+                        el = parseEnumElement(line, arena);
                     }
                     else {
                         enumBuffer += line;
-                        el = parseEnumElement(enumBuffer);
+                        el = parseEnumElement(enumBuffer, arena);
                         enumBuffer.clear();
                     }
                     assert(el);
@@ -1047,7 +1193,9 @@ namespace {
         return rootStruct;
     }
 
-    [[nodiscard]] Enum* parseRootEnum(std::string_view code, size_t begin, size_t end) {
+    [[nodiscard]] Enum* parseRootEnum(std::string_view code, size_t begin, size_t end,
+                                      Arena& arena)
+    {
         const std::string_view content = strip(code.substr(begin, end));
         assert(!content.empty());
 
@@ -1086,7 +1234,7 @@ namespace {
                     // The header information started and finished in a single row
                     assert(!isCollectingHeader);
                     assert(!rootEnum);
-                    rootEnum = parseEnum(line);
+                    rootEnum = parseEnum(line, arena);
                     assert(rootEnum);
                     continue;
                 }
@@ -1098,7 +1246,7 @@ namespace {
 
                     assert(isCollectingHeader);
                     assert(!rootEnum);
-                    rootEnum = parseEnum(enumBuffer);
+                    rootEnum = parseEnum(enumBuffer, arena);
                     assert(rootEnum);
                 
                     enumBuffer.clear();
@@ -1117,7 +1265,7 @@ namespace {
 
                 if (!enumBuffer.empty()) {
                     enumBuffer += line;
-                    EnumElement* el = parseEnumElement(enumBuffer);
+                    EnumElement* el = parseEnumElement(enumBuffer, arena);
                     assert(el);
                     enumBuffer.clear();
                     rootEnum->elements.push_back(el);
@@ -1136,11 +1284,11 @@ namespace {
 
             EnumElement* el = nullptr;
             if (enumBuffer.empty()) {
-                el = parseEnumElement(line);
+                el = parseEnumElement(line, arena);
             }
             else {
                 enumBuffer += line;
-                el = parseEnumElement(enumBuffer);
+                el = parseEnumElement(enumBuffer, arena);
                 enumBuffer.clear();
             }
             assert(el);
@@ -1151,7 +1299,8 @@ namespace {
     }
 
     Function* parseRootFunction(std::string_view code, size_t begin, size_t end,
-                                std::vector<Struct*> structs, std::vector<Enum*> enums)
+                                std::vector<Struct*> structs, std::vector<Enum*> enums,
+                                Arena& arena)
     {
         std::string_view content = strip(code.substr(begin, end));
         assert(!content.empty());
@@ -1217,7 +1366,7 @@ namespace {
             return loc;
         };
 
-        Function* f = new Function;
+        Function* f = arena.create<Function>();
 
         // Let's see if there is a documentation entry just preceding this function
         f->documentation = precedingComment(code, begin);
@@ -1283,7 +1432,7 @@ namespace {
         // need to resolve those types locally
         Struct* root = nullptr;
         if (!structs.empty() || !enums.empty()) {
-            root = new Struct;
+            root = arena.create<Struct>();
             root->name = "_root";
 
             root->children.insert(root->children.end(), structs.begin(), structs.end());
@@ -1297,7 +1446,7 @@ namespace {
             retValueLoc.first,
             retValueLoc.second
         );
-        f->returnValue = parseType(returnValueStr, root);
+        f->returnValue = parseType(returnValueStr, root, arena);
 
         //
         // Extract the function name
@@ -1363,8 +1512,8 @@ namespace {
                 }
             }
 
-            Variable* v = new Variable;
-            v->type = parseType(typeStr, root);
+            Variable* v = arena.create<Variable>();
+            v->type = parseType(typeStr, root, arena);
 
             cursor = content.find_first_not_of(' ', cursor);
             if (const size_t beg = content.substr(cursor).find("[[codegen::");
@@ -1410,7 +1559,7 @@ namespace {
             {
                 // If the variable has a default value allocated with it, we wrap the type
                 // in an optional type to represent that
-                OptionalType* ot = new OptionalType;
+                OptionalType* ot = arena.create<OptionalType>();
                 ot->tag = VariableType::Tag::OptionalType;
                 ot->type = v->type;
 
@@ -1514,86 +1663,51 @@ namespace {
 } // namespace
 
 [[nodiscard]] Code parse(std::string_view code, const std::filesystem::path& fileName) {
-    std::string codeStr = std::string(code);
     // When trying to generate code checked out on a Windows machine on a Linux virtual
     // machine, codegen gets confused with the \r\n vs \n mess. In order to prevent that
-    // we just remove all of the \r characters here
-    codeStr.erase(std::remove(codeStr.begin(), codeStr.end(), '\r'), codeStr.end());
-    code = codeStr;
-
-    // We want to keep track of the line number where we find different parts. Since we
-    // remove the code parts that we have successfully dealt with, we need to manually
-    // count the number of lines that have already been processed
-    int nSkippedLines = 0;
+    // we just remove all of the \r characters here. We only need to make a copy of the
+    // code if there actually are any \r characters, which is not the common case
+    std::string codeStr;
+    if (code.find('\r') != std::string_view::npos) {
+        codeStr = std::string(code);
+        codeStr.erase(std::remove(codeStr.begin(), codeStr.end(), '\r'), codeStr.end());
+        code = codeStr;
+    }
 
     Code res;
 
-    while (!code.empty()) {
-        enum class Type {
-            Struct,
-            Enum,
-            Function
-        };
-        struct NextCode {
-            Type type;
-            std::pair<size_t, size_t> cursors;
-        };
-        std::vector<NextCode> nextCodes;
-
-        // Collect all of the possible next code blocks
-        nextCodes.push_back({ Type::Struct, validStructCode(code) });
-        nextCodes.push_back({ Type::Enum, validEnumCode(code) });
-        nextCodes.push_back({ Type::Function, validFunctionCode(code) });
-
-        // Sort so that we can find the one that is coming up next
-        std::sort(
-            nextCodes.begin(),
-            nextCodes.end(),
-            [](const NextCode& lhs, const NextCode& rhs) {
-                return lhs.cursors.first < rhs.cursors.first;
-            }
-        );
-
-        const NextCode next = nextCodes.front();
-        if (next.cursors.first == std::string_view::npos) {
-            // If the closest cursor is already the npos, then there is no more code left
-            break;
-        }
-
-        switch (next.type) {
-            case Type::Struct: {
-                Struct* s = parseRootStruct(
-                    code,
-                    next.cursors.first,
-                    next.cursors.second
-                );
+    MarkerScanner scanner;
+    scanner.code = code;
+    while (std::optional<Marker> marker = nextMarker(scanner)) {
+        // The parsers only get to see the code since the end of the previous block so
+        // that they don't pick up a comment that belongs to an earlier block
+        const std::string_view region = code.substr(marker->regionBegin);
+        const size_t begin = marker->begin - marker->regionBegin;
+
+        switch (marker->type) {
+            case Marker::Type::Struct: {
+                Struct* s = parseRootStruct(region, begin, marker->length, *res.arena);
                 assert(s);
                 res.structs.push_back(s);
                 break;
             }
-            case Type::Enum: {
-                Enum* e = parseRootEnum(code, next.cursors.first, next.cursors.second);
+            case Marker::Type::Enum: {
+                Enum* e = parseRootEnum(region, begin, marker->length, *res.arena);
                 assert(e);
                 res.enums.push_back(e);
                 break;
             }
-            case Type::Function: {
+            case Marker::Type::Function: {
                 Function* f = parseRootFunction(
-                    code,
-                    next.cursors.first,
-                    next.cursors.second,
+                    region,
+                    begin,
+                    marker->length,
                     res.structs,
-                    res.enums
+                    res.enums,
+                    *res.arena
                 );
                 assert(f);
-
-                // Count the number of \n between the beginning and 'begin' to get the
-                // line number. Since we do line numbers 1-based, we have to add 1
-                const int nLines = static_cast<int>(
-                    std::count(code.begin(), code.begin() + next.cursors.first, '\n')
-                ) + 1;
-
-                f->sourceLocation.line = nSkippedLines + nLines;
+                f->sourceLocation.line = marker->line;
 
                 // There is probably something smarter that we can do here, but if we use
                 // the `fileName` as is we are going to end up with the
@@ -1605,7 +1719,7 @@ namespace {
                     if (f->functionName == func->functionName) {
                         throw CodegenError(std::format(
                             "Cannot define multiple functions with the same name\n{}",
-                            code.substr(next.cursors.first, 50)
+                            code.substr(marker->begin, 50)
                         ));
                     }
                 }
@@ -1614,16 +1728,6 @@ namespace {
                 break;
             }
         }
-
-        const size_t p = std::min(next.cursors.first + next.cursors.second, code.size());
-
-        // Count the number of skipped lines so that our source location stays correct
-        nSkippedLines += static_cast<int>(
-            std::count(code.begin(), code.begin() + p, '\n')
-        );
-
-        // Remove the code that we just handled
-        code.remove_prefix(p);
     }
 
     return res;
@@ -0,0 +1,183 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include "profile.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+    std::string escapeJson(std::string_view value) {
+        std::string res;
+        res.reserve(value.size());
+        for (const char c : value) {
+            if (c == '"' || c == '\\') {
+                res += '\\';
+                res += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                std::format_to(std::back_inserter(res), "\\u{:04x}", static_cast<int>(c));
+            }
+            else {
+                res += c;
+            }
+        }
+        return res;
+    }
+
+    // Returns the number of microseconds between `from` and `to`
+    double microseconds(Profile::Clock::time_point from, Profile::Clock::time_point to) {
+        return std::chrono::duration<double, std::micro>(to - from).count();
+    }
+
+    size_t phaseIndex(std::string_view phase) {
+        const auto it = std::find(ProfilePhases.begin(), ProfilePhases.end(), phase);
+        return static_cast<size_t>(std::distance(ProfilePhases.begin(), it));
+    }
+} // namespace
+
+ProfileScope::ProfileScope(Profile* p, const std::filesystem::path& file,
+                           std::string_view phase)
+    : profile(p)
+{
+    if (!profile) {
+        return;
+    }
+
+    span.file = file.string();
+    span.phase = phase;
+    span.thread = std::this_thread::get_id();
+    span.begin = Profile::Clock::now();
+}
+
+ProfileScope::~ProfileScope() {
+    if (!profile) {
+        return;
+    }
+
+    span.end = Profile::Clock::now();
+    std::lock_guard lock(profile->mutex);
+    profile->spans.push_back(std::move(span));
+}
+
+void saveProfile(const std::filesystem::path& path, const Profile& profile) {
+    std::lock_guard lock(profile.mutex);
+
+    // The trace viewers expect small integer thread ids, so we number the threads in the
+    // order in which they first appear
+    std::unordered_map<std::thread::id, int> threads;
+    for (const Profile::Span& span : profile.spans) {
+        threads.emplace(span.thread, static_cast<int>(threads.size()));
+    }
+
+    std::string res = "{\n\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [\n";
+    for (const auto& [id, tid] : threads) {
+        std::format_to(
+            std::back_inserter(res),
+            R"({{"name":"thread_name","ph":"M","pid":1,"tid":{0},)"
+            R"("args":{{"name":"Worker {0}"}}}},)"
+            "\n",
+            tid
+        );
+    }
+    for (const Profile::Span& span : profile.spans) {
+        // The span that encloses all phases is named after the file so that the files
+        // can be told apart at a glance
+        const std::string file = escapeJson(span.file);
+        const std::string name = span.phase == ProfilePhases[0] ?
+            escapeJson(std::filesystem::path(span.file).filename().string()) :
+            std::string(span.phase);
+        std::format_to(
+            std::back_inserter(res),
+            R"({{"name":"{}","cat":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},)"
+            R"("dur":{:.3f},"args":{{"file":"{}"}}}},)"
+            "\n",
+            name, span.phase, threads[span.thread],
+            microseconds(profile.start, span.begin),
+            microseconds(span.begin, span.end),
+            file
+        );
+    }
+    if (res.ends_with(",\n")) {
+        // JSON doesn't allow a trailing comma after the last event
+        res.erase(res.size() - 2, 1);
+    }
+    res += "]\n}\n";
+
+    std::ofstream file(path, std::ofstream::binary);
+    file.write(res.data(), res.size());
+}
+
+std::string slowestFiles(const Profile& profile, size_t nFiles) {
+    // Total number of milliseconds that were spent in each of the phases per file
+    using Times = std::array<double, ProfilePhases.size()>;
+    std::map<std::string, Times> files;
+    {
+        std::lock_guard lock(profile.mutex);
+        for (const Profile::Span& span : profile.spans) {
+            const size_t phase = phaseIndex(span.phase);
+            if (phase < ProfilePhases.size()) {
+                files[span.file][phase] += microseconds(span.begin, span.end) / 1000.0;
+            }
+        }
+    }
+
+    std::vector<std::pair<std::string, Times>> sorted(files.begin(), files.end());
+    std::stable_sort(
+        sorted.begin(),
+        sorted.end(),
+        [](const std::pair<std::string, Times>& lhs,
+           const std::pair<std::string, Times>& rhs)
+        {
+            return lhs.second[0] > rhs.second[0];
+        }
+    );
+    sorted.resize(std::min(sorted.size(), nFiles));
+
+    std::string res;
+    for (const std::string_view phase : ProfilePhases) {
+        std::format_to(std::back_inserter(res), "{:>10}", phase);
+    }
+    res += "  (ms)\n";
+    for (const auto& [file, times] : sorted) {
+        for (const double time : times) {
+            std::format_to(std::back_inserter(res), "{:>10.3f}", time);
+        }
+        std::format_to(std::back_inserter(res), "  {}\n", file);
+    }
+    return res;
+}
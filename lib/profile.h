@@ -0,0 +1,96 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CODEGEN___PROFILE___H__
+#define __OPENSPACE_CODEGEN___PROFILE___H__
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * The phases of handling a single file in the order in which they happen. The `file`
+ * span encloses all other phases of the same file.
+ */
+constexpr std::array<std::string_view, 8> ProfilePhases = {
+    "file", "read", "prefilter", "parse", "types", "generate", "compare", "write"
+};
+
+/**
+ * Collects the time spans that were spent in the different phases while handling files.
+ *
+ * All of the functions operating on a Profile can be called from multiple threads.
+ */
+struct Profile {
+    using Clock = std::chrono::steady_clock;
+
+    struct Span {
+        std::string file;
+        // One of the ProfilePhases
+        std::string_view phase;
+        Clock::time_point begin;
+        Clock::time_point end;
+        std::thread::id thread;
+    };
+
+    Clock::time_point start = Clock::now();
+    std::vector<Span> spans;
+    mutable std::mutex mutex;
+};
+
+/**
+ * Measures the time between the creation and the destruction of this object and adds it
+ * to the \p profile as a span of the \p phase for the \p file. If \p profile is
+ * `nullptr`, nothing is measured.
+ */
+struct ProfileScope {
+    ProfileScope(Profile* profile, const std::filesystem::path& file,
+        std::string_view phase);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    Profile* profile = nullptr;
+    Profile::Span span;
+};
+
+/**
+ * Writes all spans of the \p profile to the file at \p path in the Chrome `trace_event`
+ * JSON format, which can be opened with `chrome://tracing` or https://ui.perfetto.dev.
+ */
+void saveProfile(const std::filesystem::path& path, const Profile& profile);
+
+/**
+ * Returns a table of the \p nFiles files of the \p profile that took the longest to
+ * handle, together with the time that was spent in each phase.
+ */
+[[nodiscard]] std::string slowestFiles(const Profile& profile, size_t nFiles);
+
+#endif // __OPENSPACE_CODEGEN___PROFILE___H__
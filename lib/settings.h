@@ -29,4 +29,8 @@ constexpr bool PrintTiming = true;
 constexpr bool ShouldAlwaysWriteFiles = false;
 constexpr bool GenerateWarningsForDocumentationLessTypes = false;
 
+// Enums with at least this many elements get a switch-based lookup for converting strings
+// into values instead of a list of string comparisons
+constexpr int EnumDispatchThreshold = 8;
+
 #endif // __OPENSPACE_CODEGEN___SETTINGS___H__
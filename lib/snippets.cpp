@@ -79,7 +79,7 @@ namespace {
     constexpr std::string_view VariantConverterDouble = "   if (d.hasValue<double>(key)) { double v; bakeTo(d, key, &v); *val = std::move(v); return; }\n";
     constexpr std::string_view VariantConverterFloat = "   if (d.hasValue<double>(key)) { float v; bakeTo(d, key, &v); *val = std::move(v); return; }\n";
     constexpr std::string_view VariantConverterString = "   if (d.hasValue<std::string>(key)) { std::string v; bakeTo(d, key, &v); *val = std::move(v); return; }\n";
-    constexpr std::string_view VariantConverterPath = "   if (d.hasValue<std::string>(key)) { std::filesystem::path v; bakeTo(d, key, &v); *val = v; return; }\n";
+    constexpr std::string_view VariantConverterPath = "   if (d.hasValue<std::string>(key)) { std::filesystem::path v; bakeTo(d, key, &v); *val = std::move(v); return; }\n";
     constexpr std::string_view VariantConverterIVec2 = "   if (d.hasValue<glm::dvec2>(key)) { glm::ivec2 v; bakeTo(d, key, &v); *val = std::move(v); return; }\n";
     constexpr std::string_view VariantConverterIVec3 = "   if (d.hasValue<glm::dvec3>(key)) { glm::ivec3 v; bakeTo(d, key, &v); *val = std::move(v); return; }\n";
     constexpr std::string_view VariantConverterIVec4 = "   if (d.hasValue<glm::dvec4>(key)) { glm::ivec4 v; bakeTo(d, key, &v); *val = std::move(v); return; }\n";
@@ -214,7 +214,7 @@ std::string enumToEnumMapping(Enum* e) {
     std::string mappedTo = e->attributes.mappedTo;
     std::string fullyQualifiedName = fqn(e, "::");
     std::string result = std::format(R"(
-template <> [[maybe_unused]] {0} map<{0}, {1}>({1} value) {{
+template <> [[maybe_unused]] {2}{0} map<{0}, {1}>({1} value) {{
     switch (value) {{
         // If you end up here following a compiler error saying something about
         // 'illegal qualified name in member declaration' or such nonsense, then you tried
@@ -222,7 +222,7 @@ template <> [[maybe_unused]] {0} map<{0}, {1}>({1} value) {{
         // have. For example enum class A {{ Value1, Value2 }}; enum class B {{ Value1 }};
         // would trigger that error on trying to access B::Value2 wich is an illegal
         // qualified name. Make the enums match each other and run codegen again)",
-        mappedTo, fullyQualifiedName
+        mappedTo, fullyQualifiedName, e->attributes.isConstexpr ? "constexpr " : ""
     );
 
     for (EnumElement* ee : e->elements) {
@@ -250,10 +250,19 @@ std::string enumArrayify(Enum* e) {
     assert(!e->elements.empty());
 
     std::string fullyQualifiedName = fqn(e, "::");
-    std::string result = std::format(R"(
-template <> [[maybe_unused]] std::vector<{0}> arrayify() {{
-    return {{
+    std::string result;
+    if (e->attributes.isConstexpr) {
+        result = std::format(R"(
+template <> [[maybe_unused]] constexpr auto arrayify<{0}>() {{
+    return std::array<{0}, {1}>{{
+)", fullyQualifiedName, e->elements.size());
+    }
+    else {
+        result = std::format(R"(
+template <> [[maybe_unused]] auto arrayify<{0}>() {{
+    return std::vector<{0}>{{
 )", fullyQualifiedName);
+    }
 
     for (EnumElement* elem : e->elements) {
         result += std::format("        {0}::{1},\n", fullyQualifiedName, elem->name);
@@ -44,6 +44,14 @@ namespace {
     static_assert(sizeof(T) == 0);
     return openspace::Documentation();
 }
+
+namespace internal {
+template <typename T> [[maybe_unused]] openspace::Documentation createDocumentation(std::string, std::vector<openspace::Documentation>, bool) {
+    static_assert(sizeof(T) == 0);
+    return openspace::Documentation();
+}
+} // namespace internal
+
 )";
 
     constexpr std::string_view DocumentationPackOverload = R"(template <typename T, typename... Ds>
@@ -63,16 +71,105 @@ namespace {
 )";
 
 
+    // The verifiers are only built once by the bake<T> function, so baking many
+    // dictionaries only needs to call it for each of them. The errors of all failed
+    // dictionaries are collected so that they can be reported together. Baking a
+    // dictionary allocates, throws, and locks a mutex, none of which is allowed for the
+    // unsequenced execution policies, so `unseq` and `par_unseq` are rejected
+    constexpr std::string_view BakeManyFunctions = R"(
+// Thrown by bakeMany if at least one of the dictionaries could not be baked. `errors`
+// contains the index of each dictionary that failed together with its exception
+struct BakeManyError : public ghoul::RuntimeError {
+    struct Error {
+        size_t index = 0;
+        std::exception_ptr exception;
+    };
+
+    explicit BakeManyError(std::vector<Error> errors_)
+        : ghoul::RuntimeError(std::format("Could not bake {} dictionaries", errors_.size()))
+        , errors(std::move(errors_))
+    {}
+
+    std::vector<Error> errors;
+};
+
+template <typename T, typename ExecutionPolicy> [[maybe_unused]] std::vector<T> bakeMany(ExecutionPolicy&& policy, std::span<const ghoul::Dictionary> dictionaries) {
+    using Policy = std::remove_cvref_t<ExecutionPolicy>;
+    static_assert(
+        !std::is_same_v<Policy, std::execution::unsequenced_policy> &&
+        !std::is_same_v<Policy, std::execution::parallel_unsequenced_policy>,
+        "bakeMany does not support the unsequenced execution policies"
+    );
+    std::vector<T> res(dictionaries.size());
+    std::vector<BakeManyError::Error> errors;
+    std::mutex errorsMutex;
+    std::for_each(
+        std::forward<ExecutionPolicy>(policy),
+        dictionaries.begin(), dictionaries.end(),
+        [&](const ghoul::Dictionary& dict) {
+            const size_t i = static_cast<size_t>(&dict - dictionaries.data());
+            try {
+                res[i] = bake<T>(dict);
+            }
+            catch (...) {
+                std::lock_guard lock(errorsMutex);
+                errors.push_back({ i, std::current_exception() });
+            }
+        }
+    );
+
+    if (!errors.empty()) {
+        std::sort(
+            errors.begin(), errors.end(),
+            [](const BakeManyError::Error& lhs, const BakeManyError::Error& rhs) {
+                return lhs.index < rhs.index;
+            }
+        );
+        throw BakeManyError(std::move(errors));
+    }
+    return res;
+}
+
+template <typename T> [[maybe_unused]] std::vector<T> bakeMany(std::span<const ghoul::Dictionary> dictionaries) {
+    return bakeMany<T>(std::execution::seq, dictionaries);
+}
+)";
+
     constexpr std::string_view ToStringFallback = "template <typename T> [[maybe_unused]] std::string_view toString(T) { static_assert(sizeof(T) == 0); return \"\"; }";
     constexpr std::string_view FromStringFallback = "template <typename T> [[maybe_unused]] T fromString(std::string_view) { static_assert(sizeof(T) == 0); return T(); }";
 
     constexpr std::string_view BakeEnumFallback = "template <typename T> [[maybe_unused]] T bake(std::string_view) { static_assert(sizeof(T) == 0); return T(); }";
 
-    constexpr std::string_view ArrayifyFallback = "template <typename T> [[maybe_unused]] std::vector<T> arrayify() { return {}; }";
+    constexpr std::string_view ArrayifyFallback = "template <typename T> [[maybe_unused]] constexpr auto arrayify() { return std::vector<T>(); }";
 
+    // The documentation is only built once on the first call of the bake function and
+    // then reused for all subsequent calls. Initialization of function-local statics is
+    // thread-safe, so this works even if multiple threads bake the same struct. Only the
+    // verifiers are needed to bake, so the descriptions are left out
     constexpr std::string_view BakeStructPreamble = R"(
 template <> [[maybe_unused]] {0} bake<{0}>(const ghoul::Dictionary& dict) {{
-    openspace::testSpecificationAndThrow(codegen::doc<{0}>("{0}"), dict, "{1}");
+    static const openspace::Documentation Doc =
+        internal::createDocumentation<{0}>("{0}", {{}}, false);
+    openspace::testSpecificationAndThrow(Doc, dict, "{1}");
+    {0} res = {{}};
+)";
+
+    // Used instead of the BakeStructPreamble for structs with the `fusedbake` attribute.
+    // The third argument is the condition that checks and bakes all variables
+    constexpr std::string_view BakeStructFusedPreamble = R"(
+template <> [[maybe_unused]] {0} bake<{0}>(const ghoul::Dictionary& dict) {{
+    static const openspace::Documentation Doc =
+        internal::createDocumentation<{0}>("{0}", {{}}, false);
+    {{
+        // The values are checked while they are baked, so the dictionary only has to
+        // be traversed once. Only if one of the checks fails, the full verification is
+        // run, which reports the same errors as for the non-fused bake function
+        {0} res = {{}};
+        if ({2}) {{
+            return res;
+        }}
+    }}
+    openspace::testSpecificationAndThrow(Doc, dict, "{1}");
     {0} res = {{}};
 )";
 
@@ -97,9 +194,8 @@ template <typename T, typename U> [[maybe_unused]] T bake(const std::vector<U>&
     constexpr std::string_view BakeCustomMap = R"(
 template <typename T, typename K, typename V> [[maybe_unused]] T bake(const std::map<K, V>& v) {
     T res;
-    for (auto [key, value] : v) {
-        typename T::mapped_type r = bake<typename T::mapped_type>(std::move(value));
-        res[std::move(key)] = r;
+    for (const auto& [key, value] : v) {
+        res.try_emplace(key, bake<typename T::mapped_type>(value));
     }
     return res;
 }
@@ -121,15 +217,18 @@ template <typename T, typename U> [[maybe_unused]] T bake(const std::vector<U>&
     T res;
     res.reserve(v.size());
     for (const U& d : v) {
-        typename T::value_type r = bake<typename T::value_type>(d);
-        res.push_back(r);
+        res.push_back(bake<typename T::value_type>(d));
     }
     return res;
 }
 )";
 
+    // The descriptions of the struct and its members are only created if
+    // `withDescriptions` is true. The bake functions only need the verifiers, so they
+    // skip creating the strings, which includes all codegen::verbatim expressions
     constexpr std::string_view DocumentationPreamble = R"(
-template <> [[maybe_unused]] openspace::Documentation doc<{}>(std::string id, std::vector<openspace::Documentation> parents) {{
+namespace internal {{
+template <> [[maybe_unused]] openspace::Documentation createDocumentation<{}>(std::string id, std::vector<openspace::Documentation> parents, [[maybe_unused]] bool withDescriptions) {{
     using namespace openspace;
 
 )";
@@ -138,7 +237,7 @@ template <> [[maybe_unused]] openspace::Documentation doc<{}>(std::string id, st
     openspace::Documentation d = {{
         .name = "{0}",
         .id = std::move(id),
-        .description = R"[({2})[",
+        .description = withDescriptions ? R"[({2})[" : "",
         .entries = std::move(codegen_{1}->documentations)
     }};
 
@@ -149,6 +248,11 @@ template <> [[maybe_unused]] openspace::Documentation doc<{}>(std::string id, st
 
     return d;
 }}
+}} // namespace internal
+
+template <> [[maybe_unused]] openspace::Documentation doc<{1}>(std::string id, std::vector<openspace::Documentation> parents) {{
+    return internal::createDocumentation<{1}>(std::move(id), std::move(parents), true);
+}}
 
 )";
 
@@ -174,19 +278,21 @@ template <> [[maybe_unused]] openspace::Documentation doc<{}>(std::string id, st
             nArguments++;
 )";
 
+    // The argument is the function that pushes the value onto the stack
     constexpr std::string_view LuaWrapperPushOptional = R"(
-            if (res.has_value()) {
-                ghoul::lua::push(L, std::move(*res));
+            if (res.has_value()) {{
+                {0}(L, std::move(*res));
                 return 1;
-            }
-            else {
+            }}
+            else {{
                 return 0;
-            }
+            }}
 )";
 
+    // The second argument is the function that pushes the value onto the stack
     constexpr std::string_view LuaWrapperPushVariant = R"(
             if (std::holds_alternative<{0}>(res)) {{
-                ghoul::lua::push(L, std::move(std::get<{0}>(res)));
+                {1}(L, std::move(std::get<{0}>(res)));
             }}
 )";
 
@@ -207,14 +313,38 @@ template <> [[maybe_unused]] openspace::Documentation doc<{}>(std::string id, st
 #define ZoneScopedN(name)
 #endif // ZoneScopedN
 
+)";
+
+    constexpr std::string_view KeyFormattingInclude = R"(// The integer keys of vectors and arrays are formatted with std::to_chars
+#include <charconv>
+
+)";
+
+    constexpr std::string_view SerializeFunctionsInclude = R"(// Used by the serialize and deserialize functions
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <span>
+
+)";
+
+    constexpr std::string_view BakeManyInclude = R"(// Used by the bakeMany functions
+#include <algorithm>
+#include <exception>
+#include <execution>
+#include <mutex>
+#include <span>
+#include <type_traits>
+
 )";
 
     constexpr std::string_view BakeFunctionOptional = R"(
 template <typename T> void bakeTo(const ghoul::Dictionary& d, std::string_view key, std::optional<T>* val) {
     if (d.hasKey(key)) {
-        T v;
-        bakeTo(d, key, &v);
-        *val = v;
+        bakeTo(d, key, &val->emplace());
     }
     else {
         *val = std::nullopt;
@@ -234,17 +364,26 @@ template <typename T> void bakeTo(const ghoul::Dictionary& d, std::string_view k
     // from 1 - dict.size()  [1 because Lua for some strange reason wants to start at the
     // wrong number]
 
+    val->reserve(val->size() + dict.size());
+    // The keys are formatted into a stack buffer so that no temporary string has to be
+    // created for each element
+    char buf[24];
     for (size_t i = 1; i <= dict.size(); i++) {
-        std::string k = std::to_string(i);
+        std::string_view k = std::string_view(buf, std::to_chars(buf, buf + 24, i).ptr);
         if (!dict.hasKey(k)) {
-            throw ghoul::RuntimeError("Could not find key '" + k + "' in the dictionary");
+            throw ghoul::RuntimeError(
+                "Could not find key '" + std::string(k) + "' in the dictionary"
+            );
+        }
+        if constexpr (std::is_same_v<T, bool>) {
+            // std::vector<bool> does not hand out references to its elements
+            bool v = false;
+            bakeTo(dict, k, &v);
+            val->push_back(v);
+        }
+        else {
+            bakeTo(dict, k, &val->emplace_back());
         }
-    }
-
-    for (size_t i = 1; i <= dict.size(); i++) {
-        T v;
-        bakeTo(dict, std::to_string(i), &v);
-        val->push_back(std::move(v));
     }
 }
 )";
@@ -261,17 +400,17 @@ template <typename T, size_t N> void bakeTo(const ghoul::Dictionary& d, std::str
     // from 1 - dict.size()  [1 because Lua for some strange reason wants to start at the
     // wrong number]
 
+    // The keys are formatted into a stack buffer so that no temporary string has to be
+    // created for each element
+    char buf[24];
     for (size_t i = 1; i <= dict.size(); i++) {
-        std::string k = std::to_string(i);
+        std::string_view k = std::string_view(buf, std::to_chars(buf, buf + 24, i).ptr);
         if (!dict.hasKey(k)) {
-            throw ghoul::RuntimeError("Could not find key '" + k + "' in the dictionary");
+            throw ghoul::RuntimeError(
+                "Could not find key '" + std::string(k) + "' in the dictionary"
+            );
         }
-    }
-
-    for (size_t i = 1; i <= dict.size(); i++) {
-        T v;
-        bakeTo(dict, std::to_string(i), &v);
-        val->at(i-1) = std::move(v);
+        bakeTo(dict, k, &val->at(i - 1));
     }
 }
 )";
@@ -279,10 +418,8 @@ template <typename T, size_t N> void bakeTo(const ghoul::Dictionary& d, std::str
     constexpr std::string_view BakeFunctionTuple = R"(
 namespace {
 template <size_t I = 0, typename... Ts> void innerBake(const ghoul::Dictionary& dict, std::tuple<Ts...>* val) {
-    std::tuple_element_t<I, std::tuple<Ts...>> v;
     // +1 due to Lua 1-based counting
-    bakeTo(dict, std::to_string(I + 1), &v);
-    std::get<I>(*val) = std::move(v);
+    bakeTo(dict, std::to_string(I + 1), &std::get<I>(*val));
 
     if constexpr (I+1 != sizeof...(Ts)) {
         innerBake<I+1>(dict, val);
@@ -302,9 +439,8 @@ template <typename V> void bakeTo(const ghoul::Dictionary& d, std::string_view k
     ghoul::Dictionary dict = d.value<ghoul::Dictionary>(key);
 
     for (std::string_view k : dict.keys()) {
-        V v;
-        bakeTo(dict, k, &v);
-        val->insert({ std::string(k), v });
+        auto it = val->try_emplace(std::string(k)).first;
+        bakeTo(dict, k, &it->second);
     }
 }
 )";
@@ -313,11 +449,476 @@ template <typename K, typename V> void bakeTo(const ghoul::Dictionary& d, std::s
     ghoul::Dictionary dict = d.value<ghoul::Dictionary>(key);
 
     for (std::string_view k : dict.keys()) {
-        V v;
-        bakeTo(dict, k, &v);
-        val->insert({ codegen::fromString<K>(k), v });
+        auto it = val->try_emplace(codegen::fromString<K>(k)).first;
+        bakeTo(dict, k, &it->second);
     }
 }
+)";
+
+    // The functions used by the bake functions of structs with the `fusedbake` attribute.
+    // Each of them returns false if the value is missing or does not pass the check
+    constexpr std::string_view FusedBakeFunctions = R"(
+template <typename T> bool fusedHasValue(const ghoul::Dictionary& d, std::string_view key) {
+    if constexpr (std::is_same_v<T, int>) {
+        // Integer values are also accepted when they are stored as integral doubles
+        if (d.hasValue<int>(key)) {
+            return true;
+        }
+        if (!d.hasValue<double>(key)) {
+            return false;
+        }
+        const double v = d.value<double>(key);
+        return v >= -2147483648.0 && v <= 2147483647.0 &&
+               static_cast<double>(static_cast<int>(v)) == v;
+    }
+    else if constexpr (std::is_same_v<T, float>) {
+        return d.hasValue<double>(key);
+    }
+    else {
+        return d.hasValue<T>(key);
+    }
+}
+
+template <typename T, typename Check> bool fusedBakeTo(const ghoul::Dictionary& d, std::string_view key, T* val, Check check) {
+    if (!fusedHasValue<T>(d, key)) {
+        return false;
+    }
+    bakeTo(d, key, val);
+    return check(*val);
+}
+
+template <typename T, typename Check> bool fusedBakeTo(const ghoul::Dictionary& d, std::string_view key, std::optional<T>* val, Check check) {
+    return !d.hasKey(key) || fusedBakeTo(d, key, &val->emplace(), check);
+}
+
+template <typename T> bool fusedBakeTo(const ghoul::Dictionary& d, std::string_view key, T* val) {
+    return fusedBakeTo(d, key, val, [](const auto&) { return true; });
+}
+
+template <typename T> bool verifiedBakeTo(const ghoul::Dictionary& d, std::string_view key, T* val, const openspace::Verifier& verifier) {
+    if (!verifier(d, std::string(key)).success) {
+        return false;
+    }
+    bakeTo(d, key, val);
+    return true;
+}
+
+template <typename T> bool verifiedBakeTo(const ghoul::Dictionary& d, std::string_view key, std::optional<T>* val, const openspace::Verifier& verifier) {
+    return !d.hasKey(key) || verifiedBakeTo(d, key, &val->emplace(), verifier);
+}
+
+)";
+
+    // Used by the inline checks of fused bake functions and Lua table readers
+    constexpr std::string_view InlineCheckFunctions = R"(
+template <typename T> bool inRange(T v, T lower, T upper) {
+    return v >= lower && v <= upper;
+}
+
+[[maybe_unused]] bool inList(std::string_view v, std::initializer_list<std::string_view> list) {
+    for (std::string_view l : list) {
+        if (l == v) {
+            return true;
+        }
+    }
+    return false;
+}
+)";
+
+    // The serializeTo functions append the binary representation of a value to the
+    // buffer and the deserializeFrom functions read it back from the front of the data.
+    // Trivially copyable values (numbers, enums, glm types) are copied byte by byte, all
+    // containers are written as their number of elements followed by the elements
+    constexpr std::string_view SerializeFunctionDeclarations = R"(
+template <typename T> void serializeTo(std::vector<std::byte>& buffer, const T& value);
+template <typename T> void deserializeFrom(std::span<const std::byte>& data, T* value);
+[[maybe_unused]] void serializeTo(std::vector<std::byte>& buffer, bool value);
+[[maybe_unused]] void deserializeFrom(std::span<const std::byte>& data, bool* value);
+[[maybe_unused]] void serializeTo(std::vector<std::byte>& buffer, const std::string& value);
+[[maybe_unused]] void deserializeFrom(std::span<const std::byte>& data, std::string* value);
+)";
+    constexpr std::string_view SerializeFunctionPathDeclaration = R"(
+[[maybe_unused]] void serializeTo(std::vector<std::byte>& buffer, const std::filesystem::path& value);
+[[maybe_unused]] void deserializeFrom(std::span<const std::byte>& data, std::filesystem::path* value);
+)";
+    constexpr std::string_view SerializeFunctionOptionalDeclaration = R"(
+template <typename T> void serializeTo(std::vector<std::byte>& buffer, const std::optional<T>& value);
+template <typename T> void deserializeFrom(std::span<const std::byte>& data, std::optional<T>* value);
+)";
+    constexpr std::string_view SerializeFunctionVectorDeclaration = R"(
+template <typename T> void serializeTo(std::vector<std::byte>& buffer, const std::vector<T>& value);
+template <typename T> void deserializeFrom(std::span<const std::byte>& data, std::vector<T>* value);
+)";
+    constexpr std::string_view SerializeFunctionArrayDeclaration = R"(
+template <typename T, size_t N> void serializeTo(std::vector<std::byte>& buffer, const std::array<T, N>& value);
+template <typename T, size_t N> void deserializeFrom(std::span<const std::byte>& data, std::array<T, N>* value);
+)";
+    constexpr std::string_view SerializeFunctionMapDeclaration = R"(
+template <typename K, typename V> void serializeTo(std::vector<std::byte>& buffer, const std::map<K, V>& value);
+template <typename K, typename V> void deserializeFrom(std::span<const std::byte>& data, std::map<K, V>* value);
+)";
+    constexpr std::string_view SerializeFunctionVariantDeclaration = R"(
+template <typename... Ts> void serializeTo(std::vector<std::byte>& buffer, const std::variant<Ts...>& value);
+template <typename... Ts> void deserializeFrom(std::span<const std::byte>& data, std::variant<Ts...>* value);
+)";
+    constexpr std::string_view SerializeFunctionTupleDeclaration = R"(
+template <typename... Ts> void serializeTo(std::vector<std::byte>& buffer, const std::tuple<Ts...>& value);
+template <typename... Ts> void deserializeFrom(std::span<const std::byte>& data, std::tuple<Ts...>* value);
+)";
+
+    constexpr std::string_view SerializeFunctions = R"(
+// The values are copied in the native byte order and with the native size of their types,
+// so both are mixed into the hash of the layout to reject data from a different platform
+constexpr uint64_t platformHash(uint64_t hash, std::initializer_list<size_t> sizes) {
+    constexpr uint64_t Prime = 1099511628211ULL;
+    hash ^= (std::endian::native == std::endian::little) ? 1 : 2;
+    hash *= Prime;
+    for (const size_t size : sizes) {
+        hash ^= size;
+        hash *= Prime;
+    }
+    return hash;
+}
+
+template <typename T> void serializeTo(std::vector<std::byte>& buffer, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <typename T> void deserializeFrom(std::span<const std::byte>& data, T* value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (data.size() < sizeof(T)) {
+        throw ghoul::RuntimeError("Serialized data is truncated");
+    }
+    std::memcpy(value, data.data(), sizeof(T));
+    data = data.subspan(sizeof(T));
+}
+
+[[maybe_unused]] void serializeTo(std::vector<std::byte>& buffer, bool value) {
+    serializeTo(buffer, static_cast<uint8_t>(value ? 1 : 0));
+}
+
+[[maybe_unused]] void deserializeFrom(std::span<const std::byte>& data, bool* value) {
+    uint8_t v = 0;
+    deserializeFrom(data, &v);
+    *value = (v != 0);
+}
+
+[[maybe_unused]] void serializeTo(std::vector<std::byte>& buffer, const std::string& value) {
+    serializeTo(buffer, static_cast<uint64_t>(value.size()));
+    if (!value.empty()) {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + value.size());
+        std::memcpy(buffer.data() + offset, value.data(), value.size());
+    }
+}
+
+[[maybe_unused]] void deserializeFrom(std::span<const std::byte>& data, std::string* value) {
+    uint64_t size = 0;
+    deserializeFrom(data, &size);
+    if (data.size() < size) {
+        throw ghoul::RuntimeError("Serialized data is truncated");
+    }
+    value->assign(reinterpret_cast<const char*>(data.data()), static_cast<size_t>(size));
+    data = data.subspan(static_cast<size_t>(size));
+}
+)";
+    constexpr std::string_view SerializeFunctionPath = R"(
+[[maybe_unused]] void serializeTo(std::vector<std::byte>& buffer, const std::filesystem::path& value) {
+    // Paths are stored as UTF-8 as the native narrow encoding can't represent all paths
+    const std::u8string v = value.u8string();
+    serializeTo(buffer, std::string(v.begin(), v.end()));
+}
+
+[[maybe_unused]] void deserializeFrom(std::span<const std::byte>& data, std::filesystem::path* value) {
+    std::string v;
+    deserializeFrom(data, &v);
+    *value = std::filesystem::path(std::u8string(v.begin(), v.end()));
+}
+)";
+    constexpr std::string_view SerializeFunctionOptional = R"(
+template <typename T> void serializeTo(std::vector<std::byte>& buffer, const std::optional<T>& value) {
+    serializeTo(buffer, value.has_value());
+    if (value.has_value()) {
+        serializeTo(buffer, *value);
+    }
+}
+
+template <typename T> void deserializeFrom(std::span<const std::byte>& data, std::optional<T>* value) {
+    bool hasValue = false;
+    deserializeFrom(data, &hasValue);
+    if (hasValue) {
+        deserializeFrom(data, &value->emplace());
+    }
+    else {
+        *value = std::nullopt;
+    }
+}
+)";
+    constexpr std::string_view SerializeFunctionVector = R"(
+template <typename T> void serializeTo(std::vector<std::byte>& buffer, const std::vector<T>& value) {
+    serializeTo(buffer, static_cast<uint64_t>(value.size()));
+    for (const T& v : value) {
+        serializeTo(buffer, v);
+    }
+}
+
+template <typename T> void deserializeFrom(std::span<const std::byte>& data, std::vector<T>* value) {
+    uint64_t size = 0;
+    deserializeFrom(data, &size);
+    // The reserved size is limited by the remaining data so that a corrupted size can't
+    // cause a huge allocation
+    value->reserve(static_cast<size_t>(std::min<uint64_t>(size, data.size())));
+    for (uint64_t i = 0; i < size; i++) {
+        if constexpr (std::is_same_v<T, bool>) {
+            // std::vector<bool> does not hand out references to its elements
+            bool v = false;
+            deserializeFrom(data, &v);
+            value->push_back(v);
+        }
+        else {
+            deserializeFrom(data, &value->emplace_back());
+        }
+    }
+}
+)";
+    constexpr std::string_view SerializeFunctionArray = R"(
+template <typename T, size_t N> void serializeTo(std::vector<std::byte>& buffer, const std::array<T, N>& value) {
+    for (const T& v : value) {
+        serializeTo(buffer, v);
+    }
+}
+
+template <typename T, size_t N> void deserializeFrom(std::span<const std::byte>& data, std::array<T, N>* value) {
+    for (T& v : *value) {
+        deserializeFrom(data, &v);
+    }
+}
+)";
+    constexpr std::string_view SerializeFunctionMap = R"(
+template <typename K, typename V> void serializeTo(std::vector<std::byte>& buffer, const std::map<K, V>& value) {
+    serializeTo(buffer, static_cast<uint64_t>(value.size()));
+    for (const auto& [k, v] : value) {
+        serializeTo(buffer, k);
+        serializeTo(buffer, v);
+    }
+}
+
+template <typename K, typename V> void deserializeFrom(std::span<const std::byte>& data, std::map<K, V>* value) {
+    uint64_t size = 0;
+    deserializeFrom(data, &size);
+    for (uint64_t i = 0; i < size; i++) {
+        K k = K();
+        deserializeFrom(data, &k);
+        auto it = value->try_emplace(std::move(k)).first;
+        deserializeFrom(data, &it->second);
+    }
+}
+)";
+    constexpr std::string_view SerializeFunctionVariant = R"(
+template <typename... Ts> void serializeTo(std::vector<std::byte>& buffer, const std::variant<Ts...>& value) {
+    serializeTo(buffer, static_cast<uint64_t>(value.index()));
+    std::visit([&buffer](const auto& v) { serializeTo(buffer, v); }, value);
+}
+
+template <size_t I, typename... Ts> void deserializeVariant(std::span<const std::byte>& data, uint64_t index, std::variant<Ts...>* value) {
+    if constexpr (I < sizeof...(Ts)) {
+        if (index == I) {
+            deserializeFrom(data, &value->template emplace<I>());
+        }
+        else {
+            deserializeVariant<I + 1>(data, index, value);
+        }
+    }
+    else {
+        throw ghoul::RuntimeError("Serialized data contains an invalid variant index");
+    }
+}
+
+template <typename... Ts> void deserializeFrom(std::span<const std::byte>& data, std::variant<Ts...>* value) {
+    uint64_t index = 0;
+    deserializeFrom(data, &index);
+    deserializeVariant<0>(data, index, value);
+}
+)";
+    constexpr std::string_view SerializeFunctionTuple = R"(
+template <typename... Ts> void serializeTo(std::vector<std::byte>& buffer, const std::tuple<Ts...>& value) {
+    std::apply([&buffer](const Ts&... vs) { (serializeTo(buffer, vs), ...); }, value);
+}
+
+template <typename... Ts> void deserializeFrom(std::span<const std::byte>& data, std::tuple<Ts...>* value) {
+    std::apply([&data](Ts&... vs) { (deserializeFrom(data, &vs), ...); }, *value);
+}
+)";
+
+    // Used by luawrap functions to read struct arguments directly from a Lua table
+    // without converting it into a ghoul::Dictionary first. The accepted Lua types and
+    // the conversions are the same as those of the verifiers and the bakeTo functions.
+    // Each luaBakeTo function returns false if the value is missing or invalid
+    constexpr std::string_view LuaBakeFunctions = R"(
+template <typename T> [[maybe_unused]] T luaBake(lua_State*, int) { static_assert(sizeof(T) == 0); return T(); }
+
+[[maybe_unused]] bool luaBakeValue(lua_State* L, bool* val) {
+    if (lua_type(L, -1) != LUA_TBOOLEAN) {
+        return false;
+    }
+    *val = lua_toboolean(L, -1) != 0;
+    return true;
+}
+
+[[maybe_unused]] bool luaBakeValue(lua_State* L, int* val) {
+    if (lua_type(L, -1) != LUA_TNUMBER) {
+        return false;
+    }
+    // Integer values are also accepted when they are stored as integral doubles
+    const double v = lua_tonumber(L, -1);
+    if (!(v >= -2147483648.0 && v <= 2147483647.0) ||
+        static_cast<double>(static_cast<int>(v)) != v)
+    {
+        return false;
+    }
+    *val = static_cast<int>(v);
+    return true;
+}
+
+[[maybe_unused]] bool luaBakeValue(lua_State* L, double* val) {
+    if (lua_type(L, -1) != LUA_TNUMBER) {
+        return false;
+    }
+    *val = static_cast<double>(lua_tonumber(L, -1));
+    return true;
+}
+
+[[maybe_unused]] bool luaBakeValue(lua_State* L, float* val) {
+    if (lua_type(L, -1) != LUA_TNUMBER) {
+        return false;
+    }
+    *val = static_cast<float>(lua_tonumber(L, -1));
+    return true;
+}
+
+[[maybe_unused]] bool luaBakeValue(lua_State* L, std::string* val) {
+    if (lua_type(L, -1) != LUA_TSTRING) {
+        return false;
+    }
+    size_t length = 0;
+    const char* v = lua_tolstring(L, -1, &length);
+    val->assign(v, length);
+    return true;
+}
+
+template <typename T, typename Check> bool luaBakeTo(lua_State* L, int index, std::string_view key, T* val, Check check) {
+    lua_pushlstring(L, key.data(), key.size());
+    lua_rawget(L, index);
+    const bool success = luaBakeValue(L, val) && check(*val);
+    lua_pop(L, 1);
+    return success;
+}
+
+template <typename T, typename Check> bool luaBakeTo(lua_State* L, int index, std::string_view key, std::optional<T>* val, Check check) {
+    lua_pushlstring(L, key.data(), key.size());
+    lua_rawget(L, index);
+    const bool success =
+        lua_isnil(L, -1) || (luaBakeValue(L, &val->emplace()) && check(**val));
+    lua_pop(L, 1);
+    return success;
+}
+
+template <typename T> bool luaBakeTo(lua_State* L, int index, std::string_view key, T* val) {
+    return luaBakeTo(L, index, key, val, [](const auto&) { return true; });
+}
+)";
+
+    // The second argument is the condition that reads and checks all variables. If it
+    // fails, the table is baked through a ghoul::Dictionary instead, which reports the
+    // same errors as the bake function
+    constexpr std::string_view LuaBakeStruct = R"(
+template <> [[maybe_unused]] {0} luaBake<{0}>(lua_State* L, int index) {{
+    {0} res = {{}};
+    if (lua_istable(L, index){1}) {{
+        return res;
+    }}
+    return codegen::bake<{0}>(
+        ghoul::lua::value<ghoul::Dictionary>(L, index, ghoul::lua::PopValue::No)
+    );
+}}
+)";
+
+    // Used by luawrap functions to push return values that contain structs as Lua tables.
+    // All tables are created with their final size, so that they don't have to grow while
+    // the values are added. Values without structs are pushed by ghoul::lua::push
+    constexpr std::string_view LuaPushFunctionDeclarations = R"(
+template <typename T> void luaPush(lua_State* L, T&& value);
+template <typename T> void luaPush(lua_State* L, std::optional<T>&& value);
+template <typename T> void luaPush(lua_State* L, std::vector<T>&& value);
+template <typename V> void luaPush(lua_State* L, std::map<std::string, V>&& value);
+template <typename... Ts> void luaPush(lua_State* L, std::variant<Ts...>&& value);
+)";
+
+    constexpr std::string_view LuaPushFunctions = R"(
+template <typename T> void luaPush(lua_State* L, T&& value) {
+    ghoul::lua::push(L, std::forward<T>(value));
+}
+
+template <typename T> void luaPush(lua_State* L, std::optional<T>&& value) {
+    if (value.has_value()) {
+        luaPush(L, std::move(*value));
+    }
+    else {
+        lua_pushnil(L);
+    }
+}
+
+template <typename T> void luaPush(lua_State* L, std::vector<T>&& value) {
+    lua_createtable(L, static_cast<int>(value.size()), 0);
+    for (size_t i = 0; i < value.size(); i++) {
+        luaPush(L, std::move(value[i]));
+        lua_rawseti(L, -2, static_cast<int>(i + 1));
+    }
+}
+
+template <typename V> void luaPush(lua_State* L, std::map<std::string, V>&& value) {
+    lua_createtable(L, 0, static_cast<int>(value.size()));
+    for (auto& [key, v] : value) {
+        luaPush(L, std::move(v));
+        lua_setfield(L, -2, key.c_str());
+    }
+}
+
+template <typename... Ts> void luaPush(lua_State* L, std::variant<Ts...>&& value) {
+    std::visit([L](auto&& v) { luaPush(L, std::move(v)); }, std::move(value));
+}
+)";
+
+    constexpr std::string_view SerializeFallback = R"(
+template <typename T> [[maybe_unused]] void serialize(const T&, std::vector<std::byte>&) { static_assert(sizeof(T) == 0); }
+template <typename T> [[maybe_unused]] T deserialize(std::span<const std::byte>) { static_assert(sizeof(T) == 0); return T(); }
+)";
+
+    // Every serialized struct starts with a hash of its layout, so that data that was
+    // serialized before the struct was changed is rejected instead of misinterpreted
+    constexpr std::string_view SerializeStruct = R"(
+template <> [[maybe_unused]] void serialize<{0}>(const {0}& value, std::vector<std::byte>& buffer) {{
+    constexpr uint64_t Hash = internal::platformHash({1}ULL, {{ {2} }});
+    internal::serializeTo(buffer, Hash);
+    internal::serializeTo(buffer, value);
+}}
+
+template <> [[maybe_unused]] {0} deserialize<{0}>(std::span<const std::byte> data) {{
+    constexpr uint64_t Hash = internal::platformHash({1}ULL, {{ {2} }});
+    uint64_t hash = 0;
+    internal::deserializeFrom(data, &hash);
+    if (hash != Hash) {{
+        throw ghoul::RuntimeError(
+            "Serialized data was created for a different version of '{0}'"
+        );
+    }}
+    {0} res = {{}};
+    internal::deserializeFrom(data, &res);
+    return res;
+}}
 )";
 
 } // namespace
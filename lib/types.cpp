@@ -26,10 +26,14 @@
 
 #include "util.h"
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <charconv>
+#include <cstdint>
 #include <format>
 #include <functional>
+#include <limits>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -67,6 +71,136 @@ namespace {
         return lhs.type == rhs.type && lhs.name == rhs.name &&
             lhs.comment == rhs.comment && lhs.parent == rhs.parent;
     }
+
+    struct BasicTypeName {
+        std::string_view name;
+        BasicType::Type type = BasicType::Type::Bool;
+    };
+
+    // All spellings of the basic types that we recognize. Some types have more than one
+    // spelling (for example glm::mat2 and glm::mat2x2)
+    constexpr std::array BasicTypeNames = {
+        BasicTypeName{ "bool", BasicType::Type::Bool },
+        BasicTypeName{ "int", BasicType::Type::Int },
+        BasicTypeName{ "double", BasicType::Type::Double },
+        BasicTypeName{ "float", BasicType::Type::Float },
+        BasicTypeName{ "std::string", BasicType::Type::String },
+        BasicTypeName{ "std::filesystem::path", BasicType::Type::Path },
+        BasicTypeName{ "glm::ivec2", BasicType::Type::Ivec2 },
+        BasicTypeName{ "glm::ivec3", BasicType::Type::Ivec3 },
+        BasicTypeName{ "glm::ivec4", BasicType::Type::Ivec4 },
+        BasicTypeName{ "glm::dvec2", BasicType::Type::Dvec2 },
+        BasicTypeName{ "glm::dvec3", BasicType::Type::Dvec3 },
+        BasicTypeName{ "glm::dvec4", BasicType::Type::Dvec4 },
+        BasicTypeName{ "glm::vec2", BasicType::Type::Vec2 },
+        BasicTypeName{ "glm::vec3", BasicType::Type::Vec3 },
+        BasicTypeName{ "glm::vec4", BasicType::Type::Vec4 },
+        BasicTypeName{ "glm::mat2x2", BasicType::Type::Mat2x2 },
+        BasicTypeName{ "glm::mat2", BasicType::Type::Mat2x2 },
+        BasicTypeName{ "glm::mat2x3", BasicType::Type::Mat2x3 },
+        BasicTypeName{ "glm::mat2x4", BasicType::Type::Mat2x4 },
+        BasicTypeName{ "glm::mat3x2", BasicType::Type::Mat3x2 },
+        BasicTypeName{ "glm::mat3x3", BasicType::Type::Mat3x3 },
+        BasicTypeName{ "glm::mat3", BasicType::Type::Mat3x3 },
+        BasicTypeName{ "glm::mat3x4", BasicType::Type::Mat3x4 },
+        BasicTypeName{ "glm::mat4x2", BasicType::Type::Mat4x2 },
+        BasicTypeName{ "glm::mat4x3", BasicType::Type::Mat4x3 },
+        BasicTypeName{ "glm::mat4x4", BasicType::Type::Mat4x4 },
+        BasicTypeName{ "glm::mat4", BasicType::Type::Mat4x4 },
+        BasicTypeName{ "glm::dmat2x2", BasicType::Type::DMat2x2 },
+        BasicTypeName{ "glm::dmat2", BasicType::Type::DMat2x2 },
+        BasicTypeName{ "glm::dmat2x3", BasicType::Type::DMat2x3 },
+        BasicTypeName{ "glm::dmat2x4", BasicType::Type::DMat2x4 },
+        BasicTypeName{ "glm::dmat3x2", BasicType::Type::DMat3x2 },
+        BasicTypeName{ "glm::dmat3x3", BasicType::Type::DMat3x3 },
+        BasicTypeName{ "glm::dmat3", BasicType::Type::DMat3x3 },
+        BasicTypeName{ "glm::dmat3x4", BasicType::Type::DMat3x4 },
+        BasicTypeName{ "glm::dmat4x2", BasicType::Type::DMat4x2 },
+        BasicTypeName{ "glm::dmat4x3", BasicType::Type::DMat4x3 },
+        BasicTypeName{ "glm::dmat4x4", BasicType::Type::DMat4x4 },
+        BasicTypeName{ "glm::dmat4", BasicType::Type::DMat4x4 },
+        BasicTypeName{ "ghoul::Dictionary", BasicType::Type::Dictionary }
+    };
+
+    // The number of slots in the perfect hash table. Needs to be a power of two
+    constexpr size_t NameTableSize = 128;
+
+    constexpr uint32_t nameHash(std::string_view name, uint32_t seed) {
+        // FNV-1a with the seed mixed into the offset basis
+        uint32_t hash = 2166136261u ^ seed;
+        for (const char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash ^ (hash >> 15);
+    }
+
+    // Finds the first seed for which none of the type names collide in the table
+    constexpr uint32_t findNameSeed() {
+        for (uint32_t seed = 0; seed < 10000; seed++) {
+            std::array<bool, NameTableSize> used = {};
+            bool isPerfect = true;
+            for (const BasicTypeName& n : BasicTypeNames) {
+                const size_t slot = nameHash(n.name, seed) & (NameTableSize - 1);
+                if (used[slot]) {
+                    isPerfect = false;
+                    break;
+                }
+                used[slot] = true;
+            }
+            if (isPerfect) {
+                return seed;
+            }
+        }
+        return std::numeric_limits<uint32_t>::max();
+    }
+
+    constexpr uint32_t NameSeed = findNameSeed();
+    static_assert(
+        NameSeed != std::numeric_limits<uint32_t>::max(),
+        "Could not find a perfect hash for the basic type names"
+    );
+
+    // Maps each slot to one more than the index into BasicTypeNames, or 0 if it is empty
+    constexpr std::array<uint8_t, NameTableSize> NameTable = []() {
+        std::array<uint8_t, NameTableSize> res = {};
+        for (size_t i = 0; i < BasicTypeNames.size(); i++) {
+            const size_t slot = nameHash(BasicTypeNames[i].name, NameSeed) &
+                                (NameTableSize - 1);
+            res[slot] = static_cast<uint8_t>(i + 1);
+        }
+        return res;
+    }();
+
+    // Returns the basic type that is spelled `name` or std::nullopt if `name` is not
+    // the name of a basic type
+    std::optional<BasicType::Type> basicTypeFromName(std::string_view name) {
+        const size_t slot = nameHash(name, NameSeed) & (NameTableSize - 1);
+        const uint8_t entry = NameTable[slot];
+        if (entry == 0) {
+            return std::nullopt;
+        }
+        const BasicTypeName& n = BasicTypeNames[entry - 1];
+        if (n.name != name) {
+            return std::nullopt;
+        }
+        return n.type;
+    }
+
+    // Returns the single shared instance for the provided basic type. All variables of
+    // the same basic type point to the same object, so these must never be modified
+    const BasicType* internedBasicType(BasicType::Type type) {
+        constexpr size_t NTypes = static_cast<size_t>(BasicType::Type::Dictionary) + 1;
+        static const std::array<BasicType, NTypes> Types = []() {
+            std::array<BasicType, NTypes> res;
+            for (size_t i = 0; i < NTypes; i++) {
+                res[i].tag = VariableType::Tag::BasicType;
+                res[i].type = static_cast<BasicType::Type>(i);
+            }
+            return res;
+        }();
+        return &Types[static_cast<size_t>(type)];
+    }
 } // namespace
 
 CodegenError::CodegenError(const std::string& e) : std::runtime_error(e) {}
@@ -118,6 +252,11 @@ bool VariableType::containsCustomType() const {
 }
 
 bool operator==(const VariableType& lhs, const VariableType& rhs) {
+    // Basic types are interned, so identical types will often be the same object
+    if (&lhs == &rhs) {
+        return true;
+    }
+
     if (lhs.tag != rhs.tag) {
         return false;
     }
@@ -157,6 +296,66 @@ bool operator==(const VariableType& lhs, const VariableType& rhs) {
     }
 }
 
+size_t structuralHash(const VariableType& type) {
+    auto combine = [](size_t seed, size_t value) {
+        return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+    };
+
+    size_t res = static_cast<size_t>(type.tag);
+
+    using Tag = VariableType::Tag;
+    switch (type.tag) {
+        case Tag::BasicType: {
+            const BasicType& bt = static_cast<const BasicType&>(type);
+            return combine(res, static_cast<size_t>(bt.type));
+        }
+        case Tag::PointerType: {
+            const PointerType& pt = static_cast<const PointerType&>(type);
+            return combine(res, std::hash<std::string>()(pt.type));
+        }
+        case Tag::MapType: {
+            const MapType& mt = static_cast<const MapType&>(type);
+            res = combine(res, structuralHash(*mt.keyType));
+            return combine(res, structuralHash(*mt.valueType));
+        }
+        case Tag::OptionalType: {
+            const OptionalType& ot = static_cast<const OptionalType&>(type);
+            return combine(res, structuralHash(*ot.type));
+        }
+        case Tag::VariantType: {
+            const VariantType& vt = static_cast<const VariantType&>(type);
+            for (const VariableType* t : vt.types) {
+                res = combine(res, structuralHash(*t));
+            }
+            return res;
+        }
+        case Tag::TupleType: {
+            const TupleType& tt = static_cast<const TupleType&>(type);
+            for (const VariableType* t : tt.types) {
+                res = combine(res, structuralHash(*t));
+            }
+            return res;
+        }
+        case Tag::ArrayType: {
+            const ArrayType& at = static_cast<const ArrayType&>(type);
+            res = combine(res, structuralHash(*at.type));
+            return combine(res, static_cast<size_t>(at.size));
+        }
+        case Tag::VectorType: {
+            const VectorType& vt = static_cast<const VectorType&>(type);
+            return combine(res, structuralHash(*vt.type));
+        }
+        case Tag::CustomType: {
+            // Custom types are equal if they refer to equal struct or enum definitions,
+            // which always have the same name and parent
+            const CustomType& ct = static_cast<const CustomType&>(type);
+            res = combine(res, std::hash<std::string>()(ct.type->name));
+            return combine(res, std::hash<const void*>()(ct.type->parent));
+        }
+    }
+    throw std::logic_error("Missing case label");
+}
+
 bool operator==(const BasicType& lhs, const BasicType& rhs) {
     return lhs.type == rhs.type;
 }
@@ -268,7 +467,7 @@ std::string fqn(const StackElement* s, std::string_view separator) {
     return join(names, separator);
 }
 
-VariableType* parseType(std::string_view type, Struct* context) {
+VariableType* parseType(std::string_view type, Struct* context, Arena& arena) {
     using namespace std::literals;
 
     if (type == "void") {
@@ -281,64 +480,21 @@ VariableType* parseType(std::string_view type, Struct* context) {
         throw CodegenError(std::format("Illegal reference type found: {}", type));
     }
 
-    auto newType = [](BasicType::Type t) -> BasicType* {
-        BasicType* bt = new BasicType;
-        bt->tag = VariableType::Tag::BasicType;
-        bt->type = t;
-        return bt;
-    };
-
     VariableType* t = nullptr;
-    // NOLINTBEGIN(bugprone-branch-clone)
-    if (type == "bool")                       { t = newType(BasicType::Type::Bool); }
-    else if (type == "int")                   { t = newType(BasicType::Type::Int); }
-    else if (type == "double")                { t = newType(BasicType::Type::Double); }
-    else if (type == "float")                 { t = newType(BasicType::Type::Float); }
-    else if (type == "std::string")           { t = newType(BasicType::Type::String); }
-    else if (type == "std::filesystem::path") { t = newType(BasicType::Type::Path); }
-    else if (type == "glm::ivec2")            { t = newType(BasicType::Type::Ivec2); }
-    else if (type == "glm::ivec3")            { t = newType(BasicType::Type::Ivec3); }
-    else if (type == "glm::ivec4")            { t = newType(BasicType::Type::Ivec4); }
-    else if (type == "glm::dvec2")            { t = newType(BasicType::Type::Dvec2); }
-    else if (type == "glm::dvec3")            { t = newType(BasicType::Type::Dvec3); }
-    else if (type == "glm::dvec4")            { t = newType(BasicType::Type::Dvec4); }
-    else if (type == "glm::vec2")             { t = newType(BasicType::Type::Vec2); }
-    else if (type == "glm::vec3")             { t = newType(BasicType::Type::Vec3); }
-    else if (type == "glm::vec4")             { t = newType(BasicType::Type::Vec4); }
-    else if (type == "glm::mat2x2")           { t = newType(BasicType::Type::Mat2x2); }
-    else if (type == "glm::mat2")             { t = newType(BasicType::Type::Mat2x2); }
-    else if (type == "glm::mat2x3")           { t = newType(BasicType::Type::Mat2x3); }
-    else if (type == "glm::mat2x4")           { t = newType(BasicType::Type::Mat2x4); }
-    else if (type == "glm::mat3x2")           { t = newType(BasicType::Type::Mat3x2); }
-    else if (type == "glm::mat3x3")           { t = newType(BasicType::Type::Mat3x3); }
-    else if (type == "glm::mat3")             { t = newType(BasicType::Type::Mat3x3); }
-    else if (type == "glm::mat3x4")           { t = newType(BasicType::Type::Mat3x4); }
-    else if (type == "glm::mat4x2")           { t = newType(BasicType::Type::Mat4x2); }
-    else if (type == "glm::mat4x3")           { t = newType(BasicType::Type::Mat4x3); }
-    else if (type == "glm::mat4x4")           { t = newType(BasicType::Type::Mat4x4); }
-    else if (type == "glm::mat4")             { t = newType(BasicType::Type::Mat4x4); }
-    else if (type == "glm::dmat2x2")          { t = newType(BasicType::Type::DMat2x2); }
-    else if (type == "glm::dmat2")            { t = newType(BasicType::Type::DMat2x2); }
-    else if (type == "glm::dmat2x3")          { t = newType(BasicType::Type::DMat2x3); }
-    else if (type == "glm::dmat2x4")          { t = newType(BasicType::Type::DMat2x4); }
-    else if (type == "glm::dmat3x2")          { t = newType(BasicType::Type::DMat3x2); }
-    else if (type == "glm::dmat3x3")          { t = newType(BasicType::Type::DMat3x3); }
-    else if (type == "glm::dmat3")            { t = newType(BasicType::Type::DMat3x3); }
-    else if (type == "glm::dmat3x4")          { t = newType(BasicType::Type::DMat3x4); }
-    else if (type == "glm::dmat4x2")          { t = newType(BasicType::Type::DMat4x2); }
-    else if (type == "glm::dmat4x3")          { t = newType(BasicType::Type::DMat4x3); }
-    else if (type == "glm::dmat4x4")          { t = newType(BasicType::Type::DMat4x4); }
-    else if (type == "glm::dmat4")            { t = newType(BasicType::Type::DMat4x4); }
-    else if (type == "ghoul::Dictionary")    { t = newType(BasicType::Type::Dictionary); }
-    // NOLINTEND(bugprone-branch-clone)
+    if (const std::optional<BasicType::Type> bt = basicTypeFromName(type); bt) {
+        // The rest of the parse tree refers to types through non-const pointers, but
+        // nothing writes to a type after it has been created. Writing through this
+        // pointer would modify every variable of that basic type and is undefined
+        t = const_cast<BasicType*>(internedBasicType(*bt));
+    }
     else if (startsWith(type, "std::vector<")) {
         type.remove_prefix("std::vector<"sv.size());
         type.remove_suffix(">"sv.size());
         type = strip(type);
 
-        VectorType* vt = new VectorType;
+        VectorType* vt = arena.create<VectorType>();
         vt->tag = VariableType::Tag::VectorType;
-        vt->type = parseType(type, context);
+        vt->type = parseType(type, context, arena);
         assert(vt->type);
         t = vt;
     }
@@ -359,9 +515,9 @@ VariableType* parseType(std::string_view type, Struct* context) {
         type = type.substr(0, separator);
         type = strip(type);
 
-        ArrayType* at = new ArrayType;
+        ArrayType* at = arena.create<ArrayType>();
         at->tag = VariableType::Tag::ArrayType;
-        at->type = parseType(type, context);
+        at->type = parseType(type, context, arena);
         assert(at->type);
         int size = -1;
         auto result = std::from_chars(count.data(), count.data() + count.size(), size);
@@ -378,9 +534,9 @@ VariableType* parseType(std::string_view type, Struct* context) {
         type.remove_suffix(">"sv.size());
         type = strip(type);
 
-        OptionalType* op = new OptionalType;
+        OptionalType* op = arena.create<OptionalType>();
         op->tag = VariableType::Tag::OptionalType;
-        op->type = parseType(type, context);
+        op->type = parseType(type, context, arena);
         assert(op->type);
         t = op;
     }
@@ -390,11 +546,11 @@ VariableType* parseType(std::string_view type, Struct* context) {
         std::vector<std::string_view> list = extractTemplateTypeList(type);
         assert(list.size() == 2);
 
-        MapType* mp = new MapType;
+        MapType* mp = arena.create<MapType>();
         mp->tag = VariableType::Tag::MapType;
-        mp->keyType = parseType(list[0], context);
+        mp->keyType = parseType(list[0], context, arena);
         assert(mp->keyType);
-        mp->valueType = parseType(list[1], context);
+        mp->valueType = parseType(list[1], context, arena);
         assert(mp->valueType);
 
         const bool isValidKey = mp->hasStringKey() || mp->hasEnumKey();
@@ -411,11 +567,11 @@ VariableType* parseType(std::string_view type, Struct* context) {
 
         const std::vector<std::string_view> list = extractTemplateTypeList(type);
 
-        VariantType* vt = new VariantType;
+        VariantType* vt = arena.create<VariantType>();
         vt->tag = VariableType::Tag::VariantType;
 
         for (const std::string_view elem : list) {
-            VariableType* listType = parseType(elem, context);
+            VariableType* listType = parseType(elem, context, arena);
             assert(listType);
             vt->types.push_back(listType);
         }
@@ -454,11 +610,11 @@ VariableType* parseType(std::string_view type, Struct* context) {
 
         const std::vector<std::string_view> list = extractTemplateTypeList(type);
 
-        TupleType* tt = new TupleType;
+        TupleType* tt = arena.create<TupleType>();
         tt->tag = VariableType::Tag::TupleType;
 
         for (const std::string_view elem : list) {
-            VariableType* listType = parseType(elem, context);
+            VariableType* listType = parseType(elem, context, arena);
             assert(listType);
             tt->types.push_back(listType);
         }
@@ -466,7 +622,7 @@ VariableType* parseType(std::string_view type, Struct* context) {
         t = tt;
     }
     else if (type[type.size() - 1] == '*') {
-        PointerType* tt = new PointerType;
+        PointerType* tt = arena.create<PointerType>();
         tt->tag = VariableType::Tag::PointerType;
         // Remove the trailing *
         tt->type = type.substr(0, type.size() - 1);
@@ -483,7 +639,7 @@ VariableType* parseType(std::string_view type, Struct* context) {
             ));
         }
 
-        CustomType* ct = new CustomType;
+        CustomType* ct = arena.create<CustomType>();
         ct->tag = VariableType::Tag::CustomType;
         ct->name = std::string(type);
         const StackElement* el = resolveType(context, type);
@@ -25,7 +25,9 @@
 #ifndef __OPENSPACE_CODEGEN___TYPES___H__
 #define __OPENSPACE_CODEGEN___TYPES___H__
 
+#include "arena.h"
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -95,7 +97,14 @@ struct VariableType {
 };
 bool operator==(const VariableType& lhs, const VariableType& rhs);
 
-VariableType* parseType(std::string_view type, Struct* context);
+/**
+ * Returns a hash of the structure of the provided \p type. Types that compare equal
+ * using the operator== have the same hash, regardless of whether they are the same object
+ * or not.
+ */
+size_t structuralHash(const VariableType& type);
+
+VariableType* parseType(std::string_view type, Struct* context, Arena& arena);
 std::string generateTypename(const VariableType* type, bool fullyQualified = false);
 std::string generateLuaExtractionTypename(const VariableType* type);
 std::string generateDescriptiveTypename(const VariableType* type);
@@ -215,6 +224,14 @@ struct Struct : public StackElement {
     struct Attributes {
         std::string dictionary;
         bool noExhaustive = true; // @TODO change to false once OpenSpace works with it
+        // If true, the values are verified while they are baked instead of running the
+        // verification of the entire dictionary first
+        bool fusedBake = false;
+        // If true, the bakeMany functions that bake multiple dictionaries at once are
+        // created for this file
+        bool bakeMany = false;
+        // If true, the serialize and deserialize functions are created for this struct
+        bool serialize = false;
     };
     Attributes attributes;
 };
@@ -236,6 +253,8 @@ struct Enum : public StackElement {
     struct Attributes {
         bool stringify = false;
         bool arrayify = false;
+        // Generate the conversion functions as constexpr and arrayify as a std::array
+        bool isConstexpr = false;
         std::string mappedTo; // Another FQ enum that values of this should be mapped to
     };
     Attributes attributes;
@@ -262,6 +281,9 @@ struct Function {
 
 
 struct Code {
+    // Owns all of the structs, enums, functions, and types that are referenced below
+    std::unique_ptr<Arena> arena = std::make_unique<Arena>();
+
     std::vector<Struct*> structs;
     std::vector<Enum*> enums;
     std::vector<Function*> luaWrapperFunctions;
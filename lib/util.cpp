@@ -24,8 +24,10 @@
 
 #include "util.h"
 
+#include "keywords.h"
 #include <cassert>
 #include <cctype>
+#include <cstring>
 #include <string_view>
 #include <vector>
 
@@ -88,3 +90,24 @@ std::vector<std::string_view> extractTemplateTypeList(std::string_view types) {
 
     return res;
 }
+
+bool containsCodegenMarker(std::string_view code) {
+    using keywords::Prefix;
+
+    // memchr is vectorized in all standard libraries that we care about, so we use it to
+    // jump between the candidate [ characters and only compare the full prefix there
+    const char* it = code.data();
+    const char* end = code.data() + code.size();
+    while (static_cast<size_t>(end - it) >= Prefix.size()) {
+        const size_t remaining = static_cast<size_t>(end - it) - Prefix.size() + 1;
+        it = static_cast<const char*>(std::memchr(it, '[', remaining));
+        if (!it) {
+            return false;
+        }
+        if (std::string_view(it, Prefix.size()) == Prefix) {
+            return true;
+        }
+        it++;
+    }
+    return false;
+}
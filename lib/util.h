@@ -34,4 +34,11 @@
 [[nodiscard]] std::vector<std::string_view> extractTemplateTypeList(
     std::string_view types);
 
+/**
+ * Returns whether the \p code contains the `[[codegen::` prefix anywhere. This is much
+ * cheaper than a full parse and can be used to reject files that can't contain anything
+ * of interest to codegen.
+ */
+[[nodiscard]] bool containsCodegenMarker(std::string_view code);
+
 #endif // __OPENSPACE_CODEGEN___UTIL___H__
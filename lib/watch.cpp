@@ -0,0 +1,264 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include "watch.h"
+
+#include "types.h"
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif // __linux__
+
+namespace {
+#ifdef __linux__
+    using OnChange = std::function<void(const std::vector<std::filesystem::path>&)>;
+    using IgnoreFolder = std::function<bool(const std::filesystem::path&)>;
+
+    // A file is reported if it was closed after writing or if it was moved into a folder.
+    // New folders are reported when they are created or moved
+    constexpr uint32_t WatchMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+    struct WatchedFolder {
+        std::filesystem::path path;
+        // If this is false, only changes to the `files` are reported
+        bool allFiles = false;
+        std::vector<std::filesystem::path> files;
+    };
+
+    struct Watcher {
+        Watcher() = default;
+        Watcher(const Watcher&) = delete;
+        Watcher& operator=(const Watcher&) = delete;
+        ~Watcher() {
+            if (fd != -1) {
+                close(fd);
+            }
+        }
+
+        int fd = -1;
+        // The absolute paths of the folders and files that were requested to be watched
+        std::vector<std::filesystem::path> roots;
+        std::unordered_map<int, WatchedFolder> folders;
+        IgnoreFolder ignoreFolder;
+    };
+
+    // Adds a watch for the `folder`. If the folder can't be watched, an exception is
+    // thrown for the folders that were passed when starting to watch (`isRoot`). Folders
+    // that are found while watching might have been removed again before we got to them,
+    // which is ignored, and all other errors are only reported so that we keep watching
+    WatchedFolder* addWatch(Watcher& watcher, const std::filesystem::path& folder,
+                            bool isRoot)
+    {
+        const int wd = inotify_add_watch(watcher.fd, folder.c_str(), WatchMask);
+        if (wd == -1) {
+            const int error = errno;
+            if (isRoot) {
+                throw CodegenError(std::format(
+                    "Could not watch folder '{}': {}",
+                    folder.string(), std::strerror(error)
+                ));
+            }
+            if (error != ENOENT && error != ENOTDIR) {
+                // Most likely ENOSPC if the limit of `max_user_watches` has been reached
+                std::cerr << std::format(
+                    "warning: Could not watch folder '{}': {}\n",
+                    folder.string(), std::strerror(error)
+                );
+            }
+            return nullptr;
+        }
+        WatchedFolder& res = watcher.folders[wd];
+        res.path = folder;
+        return &res;
+    }
+
+    // Watches the `folder` and all of its subfolders. If `files` is not nullptr, all
+    // files inside the folders are added to it. This is used for folders that are created
+    // while watching since files might have been created before the watch was added.
+    // Watching a folder that is already watched does not add a second watch. `isRoot`
+    // determines how errors are handled, see addWatch
+    void watchFolder(Watcher& watcher, const std::filesystem::path& folder,
+                     std::vector<std::filesystem::path>* files, bool isRoot)
+    {
+        if (watcher.ignoreFolder(folder)) {
+            return;
+        }
+
+        WatchedFolder* watched = addWatch(watcher, folder, isRoot);
+        if (!watched) {
+            return;
+        }
+        watched->allFiles = true;
+
+        std::error_code ec;
+        for (const std::filesystem::directory_entry& e :
+             std::filesystem::directory_iterator(folder, ec))
+        {
+            if (e.is_directory(ec)) {
+                watchFolder(watcher, e.path(), files, isRoot);
+            }
+            else if (files && e.is_regular_file(ec)) {
+                files->push_back(e.path());
+            }
+        }
+    }
+
+    // Adds all files in the `roots` to `files`, including those in subfolders, and
+    // watches any subfolder that is not watched yet. This is used when the kernel dropped
+    // events, in which case we can no longer know which of the files have changed
+    void rescan(Watcher& watcher, std::vector<std::filesystem::path>& files) {
+        for (const std::filesystem::path& root : watcher.roots) {
+            std::error_code ec;
+            if (std::filesystem::is_directory(root, ec)) {
+                watchFolder(watcher, root, &files, false);
+            }
+            else if (std::filesystem::is_regular_file(root, ec)) {
+                files.push_back(root);
+            }
+        }
+    }
+
+    // Returns all files that were changed according to the `events`
+    std::vector<std::filesystem::path> changedFiles(Watcher& watcher, const char* events,
+                                                    size_t size)
+    {
+        std::vector<std::filesystem::path> res;
+        for (const char* p = events; p < events + size;) {
+            inotify_event event;
+            std::memcpy(&event, p, sizeof(inotify_event));
+            const char* name = p + sizeof(inotify_event);
+            p += sizeof(inotify_event) + event.len;
+
+            if (event.mask & IN_Q_OVERFLOW) {
+                // The event queue overflowed and events were lost, so any of the files
+                // might have changed without us being notified
+                rescan(watcher, res);
+                continue;
+            }
+
+            if (event.mask & IN_IGNORED) {
+                // The folder was removed
+                watcher.folders.erase(event.wd);
+                continue;
+            }
+
+            const auto it = watcher.folders.find(event.wd);
+            if (it == watcher.folders.end() || event.len == 0) {
+                continue;
+            }
+            const WatchedFolder& folder = it->second;
+            const std::filesystem::path path = folder.path / name;
+
+            if (event.mask & IN_ISDIR) {
+                if (folder.allFiles && (event.mask & (IN_CREATE | IN_MOVED_TO))) {
+                    watchFolder(watcher, path, &res, false);
+                }
+            }
+            else if (event.mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                if (folder.allFiles ||
+                    std::find(folder.files.begin(), folder.files.end(), path) !=
+                    folder.files.end())
+                {
+                    res.push_back(path);
+                }
+            }
+        }
+
+        // Saving a file usually causes multiple events, but each file only has to be
+        // handled once
+        std::sort(res.begin(), res.end());
+        res.erase(std::unique(res.begin(), res.end()), res.end());
+        return res;
+    }
+#endif // __linux__
+} // namespace
+
+#ifdef __linux__
+void watchFiles(const std::vector<std::filesystem::path>& roots,
+    const std::function<void(const std::vector<std::filesystem::path>&)>& onChange,
+    const std::function<bool(const std::filesystem::path&)>& ignoreFolder)
+{
+    Watcher watcher;
+    watcher.ignoreFolder = ignoreFolder;
+    watcher.fd = inotify_init1(IN_CLOEXEC);
+    if (watcher.fd == -1) {
+        throw CodegenError(std::format(
+            "Could not initialize file watching: {}", std::strerror(errno)
+        ));
+    }
+
+    for (const std::filesystem::path& root : roots) {
+        const std::filesystem::path path = std::filesystem::absolute(root);
+        watcher.roots.push_back(path);
+        if (std::filesystem::is_directory(path)) {
+            watchFolder(watcher, path, nullptr, true);
+        }
+        else {
+            // Files can't be watched directly as editors usually replace the file when
+            // saving, so we watch the folder instead and only report changes to the file
+            addWatch(watcher, path.parent_path(), true)->files.push_back(path);
+        }
+    }
+
+    // The buffer has to be aligned for the inotify_event structs and large enough for
+    // many events so that all events caused by saving a file are read at once
+    alignas(inotify_event) char buffer[64 * 1024];
+    while (true) {
+        const ssize_t length = read(watcher.fd, buffer, sizeof(buffer));
+        if (length == -1 && errno == EINTR) {
+            continue;
+        }
+        if (length <= 0) {
+            throw CodegenError(
+                std::format("Could not watch files: {}", std::strerror(errno))
+            );
+        }
+
+        const std::vector<std::filesystem::path> files =
+            changedFiles(watcher, buffer, static_cast<size_t>(length));
+        if (!files.empty()) {
+            onChange(files);
+        }
+    }
+}
+#else // ^^^^ __linux__ // !__linux__ vvvv
+void watchFiles(const std::vector<std::filesystem::path>&,
+    const std::function<void(const std::vector<std::filesystem::path>&)>&,
+    const std::function<bool(const std::filesystem::path&)>&)
+{
+    throw CodegenError("Watching files is only supported on Linux");
+}
+#endif // __linux__
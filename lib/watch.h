@@ -0,0 +1,48 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CODEGEN___WATCH___H__
+#define __OPENSPACE_CODEGEN___WATCH___H__
+
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+/**
+ * Watches the provided \p roots, which can be folders or files, and calls \p onChange
+ * with all files that were written to or moved into one of the folders since the last
+ * call. Subfolders of watched folders are watched as well, including subfolders that are
+ * created while watching, and the files that these new folders contain are passed to
+ * \p onChange. Folders for which \p ignoreFolder returns `true` are not watched. If the
+ * operating system dropped events because too many files changed at once, all files in
+ * the \p roots are passed to \p onChange.
+ *
+ * This function only returns by throwing a CodegenError if the files can't be watched.
+ * Watching files is only supported on Linux.
+ */
+void watchFiles(const std::vector<std::filesystem::path>& roots,
+    const std::function<void(const std::vector<std::filesystem::path>&)>& onChange,
+    const std::function<bool(const std::filesystem::path&)>& ignoreFolder);
+
+#endif // __OPENSPACE_CODEGEN___WATCH___H__
@@ -22,17 +22,26 @@
  * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
  ****************************************************************************************/
 
+#include "cache.h"
 #include "codegen.h"
+#include "profile.h"
 #include "settings.h"
+#include "watch.h"
 #include <algorithm>
+#include <atomic>
+#include <charconv>
 #include <chrono>
 #include <cstdlib>
 #include <filesystem>
 #include <format>
+#include <fstream>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 // TODO
@@ -42,10 +51,87 @@
 //   - Add support for glm::uvecX
 
 namespace {
-    long long totalTime = 0;
-    int ChangedFiles = 0;
-    int AllFiles = 0;
+    std::atomic<long long> totalTime = 0;
+    std::atomic<int> ChangedFiles = 0;
+    std::atomic<int> AllFiles = 0;
     bool isVerbose = false;
+
+    // If this is true, the tool keeps running after the first pass and regenerates files
+    // whenever they are changed
+    bool isWatching = false;
+
+    // The number of threads that are used to process files. 0 means that the hardware
+    // concurrency is used
+    unsigned int nJobs = 0;
+
+    // If this is not empty, the information about processed files is stored in this file
+    // and reused between runs
+    std::string_view cacheFile;
+
+    // If this is not empty, the paths of all generated files are written to this file.
+    // The file is written on every successful run, so build systems can use it as the
+    // output of the codegen step
+    std::string_view outputsManifest;
+
+    // If this is not empty, a Makefile-style dependency file is written to this file that
+    // lists all inspected source files as the dependencies of the outputs manifest
+    std::string_view depFile;
+
+    // If this is not empty, the time spent in each phase of handling each file is written
+    // to this file in the Chrome trace event format and the slowest files are printed
+    std::string_view profileFile;
+
+    unsigned int parseJobs(std::string_view value) {
+        unsigned int res = 0;
+        auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), res);
+        if (ec != std::errc() || ptr != value.data() + value.size() || res == 0) {
+            std::cerr << std::format(
+                "Number of jobs must be a positive integer. Got '{}'\n", value
+            );
+            exit(EXIT_FAILURE);
+        }
+        return res;
+    }
+
+    // Escapes the characters that have a special meaning in a Makefile-style dependency
+    // file
+    std::string escapeDependency(const std::filesystem::path& path) {
+        std::string res;
+        for (const char c : std::filesystem::absolute(path).generic_string()) {
+            if (c == ' ' || c == '#') {
+                res += '\\';
+            }
+            else if (c == '$') {
+                res += '$';
+            }
+            res += c;
+        }
+        return res;
+    }
+
+    // Returns whether the file at `path` is a source file that should be inspected for
+    // codegen markers. Files in the `ext` folder and generated files are ignored
+    bool isSourceFile(const std::filesystem::path& path, std::string_view extFolder) {
+        const std::string p = path.string();
+        const bool isSource = path.extension() == ".cpp" || path.extension() == ".inl";
+        const bool isCodegen = p.contains("_codegen.cpp");
+        const bool isExt = p.contains(extFolder);
+        if (isVerbose && !(isSource && !isCodegen && !isExt)) {
+            std::cout << std::format(
+                "Rejecting {}. Extension: {}; Codegen-ness: {}; Ext-ness: {}\n",
+                p, path.extension().string(), !isCodegen, !isExt
+            );
+        }
+        return isSource && !isCodegen && !isExt;
+    }
+
+    // Creates the parent folder of the file if it doesn't exist yet and opens the file
+    std::ofstream openOutputFile(const std::filesystem::path& path) {
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path());
+        }
+        return std::ofstream(path, std::ofstream::binary);
+    }
 } // namespace
 
 template <>
@@ -64,7 +150,10 @@ namespace fs = std::filesystem;
 int main(int argc, char** argv) {
     if (argc < 2) {
         std::cerr <<
-            "Wrong number of parameters. Expected at least 2.\nUsage: codegen <folder>\n";
+            "Wrong number of parameters. Expected at least 2.\n"
+            "Usage: codegen [--verbose] [--watch] [-j N | --jobs N] [--cache <file>] "
+            "[--outputs-manifest <file> [--depfile <file>]] [--profile <file>] "
+            "<folder>\n";
         exit(EXIT_FAILURE);
     }
 
@@ -76,6 +165,69 @@ int main(int argc, char** argv) {
             isVerbose = true;
             continue;
         }
+        if (src == "--watch") {
+            isWatching = true;
+            continue;
+        }
+        if (src == "-j" || src == "--jobs") {
+            if (i + 1 >= argc) {
+                std::cerr << std::format("Missing number of jobs after '{}'\n", src);
+                exit(EXIT_FAILURE);
+            }
+            i++;
+            nJobs = parseJobs(argv[i]);
+            continue;
+        }
+        if (src == "--cache") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing file name after '--cache'\n";
+                exit(EXIT_FAILURE);
+            }
+            i++;
+            cacheFile = argv[i];
+            continue;
+        }
+        if (src == "--outputs-manifest" || src == "--depfile" || src == "--profile") {
+            if (i + 1 >= argc) {
+                std::cerr << std::format("Missing file name after '{}'\n", src);
+                exit(EXIT_FAILURE);
+            }
+            i++;
+            if (src == "--depfile") {
+                depFile = argv[i];
+            }
+            else if (src == "--profile") {
+                profileFile = argv[i];
+            }
+            else {
+                outputsManifest = argv[i];
+            }
+            continue;
+        }
+        if (src.starts_with("--cache=")) {
+            cacheFile = src.substr(std::string_view("--cache=").size());
+            continue;
+        }
+        if (src.starts_with("--outputs-manifest=")) {
+            outputsManifest = src.substr(std::string_view("--outputs-manifest=").size());
+            continue;
+        }
+        if (src.starts_with("--depfile=")) {
+            depFile = src.substr(std::string_view("--depfile=").size());
+            continue;
+        }
+        if (src.starts_with("--profile=")) {
+            profileFile = src.substr(std::string_view("--profile=").size());
+            continue;
+        }
+        if (src.starts_with("--jobs=")) {
+            nJobs = parseJobs(src.substr(std::string_view("--jobs=").size()));
+            continue;
+        }
+        if (src.starts_with("-j")) {
+            nJobs = parseJobs(src.substr(std::string_view("-j").size()));
+            continue;
+        }
 
         std::cout << " " << src;
 
@@ -91,6 +243,13 @@ int main(int argc, char** argv) {
     }
     std::cout << '\n';
 
+    if (!depFile.empty() && outputsManifest.empty()) {
+        // The dependency file needs a target and the manifest is the only file that is
+        // written on every run
+        std::cerr << "'--depfile' can only be used together with '--outputs-manifest'\n";
+        exit(EXIT_FAILURE);
+    }
+
     auto beg = std::chrono::high_resolution_clock::now();
 
     std::vector<fs::path> entries;
@@ -105,39 +264,57 @@ int main(int argc, char** argv) {
 
         // It's a folder then
         for (const fs::directory_entry& p : fs::recursive_directory_iterator(src)) {
-            const std::filesystem::path& path = p.path();
-
-            if ((path.extension() == ".cpp" || path.extension() == ".inl") &&
-                !path.string().contains("_codegen.cpp") &&
-                !path.string().contains(extFolder))
-            {
+            if (isSourceFile(p.path(), extFolder)) {
                 entries.push_back(p);
             }
-            else {
-                if (isVerbose) {
-                    std::cout << std::format(
-                        "Rejecting {}. Extension: {}; Codegen-ness: {}; Ext-ness: {}\n",
-                        path,
-                        path.extension(),
-                        !path.string().contains("_codegen.cpp"),
-                        !path.string().contains(extFolder)
-                    );
-                }
-            }
         }
     }
 
-    std::for_each(
-        entries.cbegin(), entries.cend(),
-        [](const fs::path& p) {
+    Cache cache;
+    if (!cacheFile.empty()) {
+        loadCache(cacheFile, cache);
+    }
+    // When watching, the cache is always used, even if it is not stored, so that files
+    // whose content did not change are not parsed again
+    Cache* c = (cacheFile.empty() && !isWatching) ? nullptr : &cache;
+    Statistics statistics;
+    Profile profile;
+    Profile* prof = profileFile.empty() ? nullptr : &profile;
+
+    // Every file is independent of all others, so we can distribute them to a number of
+    // worker threads. Each worker picks the next unprocessed file from the shared list,
+    // so that a thread that finishes early keeps on stealing work from the remaining
+    // files instead of sitting idle. Errors are stored per file and only reported after
+    // all workers have finished so that the reported error does not depend on the order
+    // in which the threads happened to finish
+    std::vector<std::optional<std::string>> errors(entries.size());
+    std::vector<Result> results(entries.size(), Result::NotProcessed);
+    std::atomic<size_t> nextEntry = 0;
+    std::atomic<bool> hasError = false;
+
+    auto worker = [&entries, &errors, &results, &nextEntry, &hasError, c, &statistics,
+                   prof]()
+    {
+        // When watching, an error in one file should not prevent the others from being
+        // processed as the error will be fixed in a later change
+        while (isWatching || !hasError) {
+            const size_t i = nextEntry++;
+            if (i >= entries.size()) {
+                break;
+            }
+
+            const fs::path& p = entries[i];
             try {
                 if (isVerbose) {
-                    std::cout << "Processing: " << p << '\n';
+                    std::cout << std::format("Processing: {}\n", p);
                 }
 
+                // While watching, the files are likely being edited at the same time, so
+                // they are not memory-mapped, see below
                 auto begin = std::chrono::high_resolution_clock::now();
-                const Result res = handleFile(p);
+                const Result res = handleFile(p, c, &statistics, prof, !isWatching);
                 auto end = std::chrono::high_resolution_clock::now();
+                results[i] = res;
                 if (res == Result::Processed) {
                     ChangedFiles++;
                     totalTime += (end - begin).count();
@@ -147,11 +324,80 @@ int main(int argc, char** argv) {
                 }
             }
             catch (const std::runtime_error& e) {
-                std::cerr << std::format("\n\n{}: error: {}\n\n\n", p.string(), e.what());
+                errors[i] = e.what();
+                hasError = true;
+            }
+        }
+    };
+
+    if (nJobs == 0) {
+        nJobs = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    const size_t nThreads = std::min<size_t>(nJobs, entries.size());
+    if (nThreads <= 1) {
+        worker();
+    }
+    else {
+        std::vector<std::thread> threads;
+        threads.reserve(nThreads);
+        for (size_t i = 0; i < nThreads; i++) {
+            threads.emplace_back(worker);
+        }
+        for (std::thread& t : threads) {
+            t.join();
+        }
+    }
+
+    if (!cacheFile.empty()) {
+        // Files that failed have been removed from the cache, so it is safe to store
+        // the cache even if there were errors
+        saveCache(cacheFile, cache);
+    }
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (errors[i].has_value()) {
+            std::cerr << std::format(
+                "\n\n{}: error: {}\n\n\n", entries[i].string(), *errors[i]
+            );
+            if (!isWatching) {
                 exit(EXIT_FAILURE);
             }
         }
-    );
+    }
+
+    if (!outputsManifest.empty()) {
+        std::ofstream manifest = openOutputFile(outputsManifest);
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (results[i] != Result::NotProcessed) {
+                manifest << std::filesystem::absolute(destinationPath(entries[i]))
+                    .generic_string() << '\n';
+            }
+        }
+    }
+
+    if (!depFile.empty()) {
+        std::ofstream dependencies = openOutputFile(depFile);
+        dependencies << escapeDependency(outputsManifest) << ':';
+        for (const fs::path& p : entries) {
+            dependencies << " \\\n  " << escapeDependency(p);
+        }
+        dependencies << '\n';
+    }
+
+    if (prof) {
+        saveProfile(profileFile, profile);
+        std::cout << std::format("Slowest files:\n{}", slowestFiles(profile, 10));
+    }
+
+    if (isVerbose) {
+        const int nFiles = statistics.nPrefilteredFiles;
+        const int nHits = statistics.nPrefilterHits;
+        std::cout << std::format(
+            "Prefilter: {}/{} inspected files contained a codegen marker ({:.1f}%)\n",
+            nHits, nFiles,
+            nFiles > 0 ? 100.0 * static_cast<double>(nHits) / nFiles : 0.0
+        );
+    }
 
     auto end = std::chrono::high_resolution_clock::now();
     const double ms = static_cast<double>((end - beg).count()) / 1000000.0;
@@ -159,10 +405,59 @@ int main(int argc, char** argv) {
     if (PrintTiming) {
         std::cout << std::format(
             "{}/{} files changed in {} ms.  Pure time in codegen: {} ms\n",
-            ChangedFiles, AllFiles, ms, static_cast<double>(totalTime) / 1000000.0
+            ChangedFiles.load(), AllFiles.load(), ms,
+            static_cast<double>(totalTime.load()) / 1000000.0
         );
     }
     else {
-        std::cout << std::format("{}/{} files changed\n", ChangedFiles, AllFiles);
+        std::cout << std::format(
+            "{}/{} files changed\n", ChangedFiles.load(), AllFiles.load()
+        );
+    }
+
+    if (!isWatching) {
+        return EXIT_SUCCESS;
+    }
+
+    std::cout << "Watching for changes. Press Ctrl+C to stop\n";
+    std::vector<fs::path> roots;
+    roots.reserve(srcs.size());
+    for (const std::string_view src : srcs) {
+        roots.emplace_back(src);
+    }
+    auto onChange = [&extFolder, &cache, &statistics](const std::vector<fs::path>& ps) {
+        bool hasChanged = false;
+        for (const fs::path& p : ps) {
+            if (!isSourceFile(p, extFolder) || !fs::is_regular_file(p)) {
+                continue;
+            }
+
+            try {
+                // The file was just written and the next save might truncate it while
+                // we are still reading it, so the file must not be memory-mapped
+                const Result res = handleFile(p, &cache, &statistics, nullptr, false);
+                hasChanged |= res == Result::Processed;
+            }
+            catch (const std::runtime_error& e) {
+                std::cerr << std::format("\n\n{}: error: {}\n\n\n", p.string(), e.what());
+            }
+        }
+
+        if (hasChanged && !cacheFile.empty()) {
+            saveCache(cacheFile, cache);
+        }
+    };
+    auto isIgnored = [&extFolder](const fs::path& folder) {
+        return (folder.string() + fs::path::preferred_separator).contains(extFolder);
+    };
+
+    try {
+        // This function only returns if there was an error, otherwise we keep on watching
+        // until the user interrupts the program
+        watchFiles(roots, onChange, isIgnored);
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << std::format("error: {}\n", e.what());
     }
+    return EXIT_FAILURE;
 }
@@ -0,0 +1,240 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <ghoul/misc/dictionary.h>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+// This benchmark replaces the global operator new to count the allocations, so it is
+// built into the `codegen-bench-bake` executable of its own instead of `codegentest`
+
+namespace {
+    // Every copy of one of the containers below requires at least one heap allocation,
+    // so the number of allocations during a bake is an upper bound for the number of
+    // copies the generated code makes. The default array and nothrow forms of the
+    // operator new call the replaced one, so they are counted as well. None of the types
+    // are over-aligned, so the aligned forms are never used
+    std::atomic<size_t> nAllocations = 0;
+} // namespace
+
+void* operator new(size_t size) {
+    nAllocations++;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+    struct [[codegen::Dictionary(BenchmarkCopies)]] Parameters {
+        // mapOfVectors documentation
+        std::map<std::string, std::vector<std::string>> mapOfVectors;
+
+        // optionalVector documentation
+        std::optional<std::vector<std::string>> optionalVector;
+
+        // tuple documentation
+        std::tuple<std::vector<std::string>, std::string> tuple;
+
+        struct Sub {
+            // values documentation
+            std::vector<std::string> values;
+        };
+        // subs documentation
+        std::vector<Sub> subs;
+    };
+} // namespace
+#include "benchmark_bake_copies_codegen.cpp"
+
+namespace {
+    ghoul::Dictionary stringList(int n) {
+        ghoul::Dictionary res;
+        for (int i = 1; i <= n; i++) {
+            // Long enough to defeat the small string optimization
+            res.setValue(std::to_string(i), "value number " + std::to_string(i) + "____");
+        }
+        return res;
+    }
+
+    template <typename F>
+    size_t countAllocations(F&& f) {
+        const size_t before = nAllocations;
+        f();
+        return nAllocations - before;
+    }
+
+    // The functions below read the values with the fewest calls into the Dictionary
+    // that the generated code can make. Every value and every table that is read from a
+    // Dictionary is a copy, so the number of allocations in these functions, including
+    // the ones that are needed for the result, is the upper bound for a bake that doesn't
+    // make any copies of its own
+    std::vector<std::string> readStrings(const ghoul::Dictionary& d,
+                                         std::string_view key)
+    {
+        const ghoul::Dictionary dict = d.value<ghoul::Dictionary>(key);
+        std::vector<std::string> res;
+        res.reserve(dict.size());
+        for (size_t i = 1; i <= dict.size(); i++) {
+            res.push_back(dict.value<std::string>(std::to_string(i)));
+        }
+        return res;
+    }
+
+    void readMapOfVectors(const ghoul::Dictionary& d,
+                          std::map<std::string, std::vector<std::string>>* val)
+    {
+        const ghoul::Dictionary dict = d.value<ghoul::Dictionary>("MapOfVectors");
+        for (std::string_view k : dict.keys()) {
+            (*val)[std::string(k)] = readStrings(dict, k);
+        }
+    }
+
+    void readOptionalVector(const ghoul::Dictionary& d,
+                            std::optional<std::vector<std::string>>* val)
+    {
+        if (d.hasKey("OptionalVector")) {
+            *val = readStrings(d, "OptionalVector");
+        }
+    }
+
+    void readTuple(const ghoul::Dictionary& d,
+                   std::tuple<std::vector<std::string>, std::string>* val)
+    {
+        const ghoul::Dictionary dict = d.value<ghoul::Dictionary>("Tuple");
+        std::get<0>(*val) = readStrings(dict, "1");
+        std::get<1>(*val) = dict.value<std::string>("2");
+    }
+
+    void readSubs(const ghoul::Dictionary& d, std::vector<Parameters::Sub>* val) {
+        const ghoul::Dictionary dict = d.value<ghoul::Dictionary>("Subs");
+        val->reserve(dict.size());
+        for (size_t i = 1; i <= dict.size(); i++) {
+            // The generated code reads each struct as a table before reading its members
+            const std::string k = std::to_string(i);
+            const ghoul::Dictionary sub = dict.value<ghoul::Dictionary>(k);
+            val->push_back({ .values = readStrings(sub, "Values") });
+        }
+    }
+} // namespace
+
+TEST_CASE("Benchmark/Bake: Copies", "[benchmark]") {
+    constexpr int N = 100;
+
+    ghoul::Dictionary d;
+    {
+        ghoul::Dictionary e;
+        for (int i = 0; i < N; i++) {
+            e.setValue("key" + std::to_string(i), stringList(N));
+        }
+        d.setValue("MapOfVectors", e);
+    }
+    d.setValue("OptionalVector", stringList(N));
+    {
+        ghoul::Dictionary e;
+        e.setValue("1", stringList(N));
+        e.setValue("2", std::string("a string that does not fit into the SSO buffer"));
+        d.setValue("Tuple", e);
+    }
+    {
+        ghoul::Dictionary e;
+        for (int i = 1; i <= N; i++) {
+            ghoul::Dictionary s;
+            s.setValue("Values", stringList(N));
+            e.setValue(std::to_string(i), s);
+        }
+        d.setValue("Subs", e);
+    }
+
+    // Warm up the function-local statics, such as the documentation, first
+    Parameters p = codegen::bake<Parameters>(d);
+    REQUIRE(p.mapOfVectors.size() == N);
+    REQUIRE(p.optionalVector.has_value());
+    REQUIRE(p.subs.size() == N);
+
+    const size_t allocations = countAllocations([&]() {
+        p = codegen::bake<Parameters>(d);
+    });
+    WARN("Allocations per bake: " << allocations);
+
+    // Each member on its own, compared with the reads that can't be avoided
+    Parameters baked;
+    Parameters read;
+    const size_t mapOfVectors = countAllocations([&]() {
+        codegen::internal::bakeTo(d, "MapOfVectors", &baked.mapOfVectors);
+    });
+    CHECK(mapOfVectors <= countAllocations([&]() {
+        readMapOfVectors(d, &read.mapOfVectors);
+    }));
+
+    const size_t optionalVector = countAllocations([&]() {
+        codegen::internal::bakeTo(d, "OptionalVector", &baked.optionalVector);
+    });
+    CHECK(optionalVector <= countAllocations([&]() {
+        readOptionalVector(d, &read.optionalVector);
+    }));
+
+    const size_t tuple = countAllocations([&]() {
+        codegen::internal::bakeTo(d, "Tuple", &baked.tuple);
+    });
+    CHECK(tuple <= countAllocations([&]() { readTuple(d, &read.tuple); }));
+
+    const size_t subs = countAllocations([&]() {
+        codegen::internal::bakeTo(d, "Subs", &baked.subs);
+    });
+    CHECK(subs <= countAllocations([&]() { readSubs(d, &read.subs); }));
+
+    REQUIRE(baked.mapOfVectors.size() == read.mapOfVectors.size());
+    REQUIRE(baked.subs.size() == read.subs.size());
+
+    // The entire bake additionally verifies the dictionary against the documentation
+    const openspace::Documentation doc = codegen::doc<Parameters>("BenchmarkCopies");
+    const size_t verification = countAllocations([&]() {
+        openspace::testSpecificationAndThrow(doc, d, "BenchmarkCopies");
+    });
+    CHECK(allocations <= verification + mapOfVectors + optionalVector + tuple + subs);
+
+    BENCHMARK("bake") {
+        return codegen::bake<Parameters>(d);
+    };
+}
@@ -0,0 +1,159 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "codegen.h"
+#include "corpus.h"
+#include "parsing.h"
+#include "types.h"
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+    // handleFile reports every file it writes on std::cout, which is also where the
+    // reporters of Catch2 write to, so that output has to be discarded while the files are
+    // handled to keep the xml and json reports valid. Failed checks are only reported
+    // after the output has been restored
+    struct DiscardCout {
+        struct NullBuffer : public std::streambuf {
+            int overflow(int c) override { return traits_type::not_eof(c); }
+        };
+
+        DiscardCout() : original(std::cout.rdbuf(&null)) {}
+        ~DiscardCout() { std::cout.rdbuf(original); }
+
+        DiscardCout(const DiscardCout&) = delete;
+        DiscardCout& operator=(const DiscardCout&) = delete;
+
+        NullBuffer null;
+        std::streambuf* original = nullptr;
+    };
+
+    // Removes the folder when the test case ends, including when a REQUIRE fails
+    struct RemoveFolder {
+        ~RemoveFolder() {
+            std::error_code ec;
+            std::filesystem::remove_all(folder, ec);
+        }
+
+        std::filesystem::path folder;
+    };
+} // namespace
+
+// Each benchmark runs over all files of the corpus, so the reported times are for the
+// entire corpus and not for a single file
+
+TEST_CASE("Benchmark/Corpus: parse", "[benchmark]") {
+    const std::vector<std::string> corpus = generateCorpus(BenchmarkCorpus);
+    REQUIRE(!corpus.empty());
+
+    // Make sure that the corpus is actually parsed completely
+    const Code code = parse(corpus.front());
+    REQUIRE(code.structs.size() == static_cast<size_t>(BenchmarkCorpus.nStructs));
+    REQUIRE(code.enums.size() == (BenchmarkCorpus.nEnumValues > 0 ? 1 : 0));
+    REQUIRE(
+        code.luaWrapperFunctions.size() == static_cast<size_t>(BenchmarkCorpus.nFunctions)
+    );
+
+    BENCHMARK("parse") {
+        size_t nStructs = 0;
+        for (const std::string& file : corpus) {
+            nStructs += parse(file).structs.size();
+        }
+        return nStructs;
+    };
+}
+
+TEST_CASE("Benchmark/Corpus: generateResult", "[benchmark]") {
+    const std::vector<std::string> corpus = generateCorpus(BenchmarkCorpus);
+
+    std::vector<Code> codes;
+    codes.reserve(corpus.size());
+    for (size_t i = 0; i < corpus.size(); i++) {
+        Code code = parse(corpus[i]);
+        code.sourceFile = std::format("benchmark{}.cpp", i);
+        codes.push_back(std::move(code));
+    }
+
+    BENCHMARK("generateResult") {
+        size_t size = 0;
+        for (const Code& code : codes) {
+            size += generateResult(code).size();
+        }
+        return size;
+    };
+}
+
+TEST_CASE("Benchmark/Corpus: handleFile", "[benchmark]") {
+    const std::vector<std::string> corpus = generateCorpus(BenchmarkCorpus);
+
+    // Each run uses its own folder so that benchmarks running at the same time don't
+    // overwrite each other's files. create_directory fails if the folder already exists
+    std::random_device rd;
+    std::filesystem::path folder;
+    do {
+        folder = std::filesystem::temp_directory_path() /
+            std::format("codegen-bench-{:08x}{:08x}", rd(), rd());
+    } while (!std::filesystem::create_directory(folder));
+    const RemoveFolder removeFolder = { folder };
+
+    std::vector<std::filesystem::path> files;
+    for (size_t i = 0; i < corpus.size(); i++) {
+        const std::filesystem::path path = folder / std::format("benchmark{}.cpp", i);
+        std::ofstream(path, std::ofstream::binary) << corpus[i];
+        files.push_back(path);
+    }
+
+    // The first run writes the generated files, so the benchmark measures the common
+    // case of a run in which the generated files are compared but don't change
+    std::vector<Result> results;
+    {
+        const DiscardCout discard;
+        for (const std::filesystem::path& path : files) {
+            results.push_back(handleFile(path));
+        }
+    }
+    for (Result result : results) {
+        REQUIRE(result == Result::Processed);
+    }
+
+    BENCHMARK("handleFile") {
+        const DiscardCout discard;
+        int nSkipped = 0;
+        for (const std::filesystem::path& path : files) {
+            nSkipped += handleFile(path) == Result::Skipped;
+        }
+        return nSkipped;
+    };
+}
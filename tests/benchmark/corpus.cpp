@@ -0,0 +1,125 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include "corpus.h"
+
+#include <array>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+    // The member types cycle through a mix of simple types and deeply nested ones, which
+    // are the most expensive to parse and generate
+    constexpr std::array<std::string_view, 8> MemberTypes = {
+        "int",
+        "std::optional<double>",
+        "std::string",
+        "std::vector<glm::dvec3>",
+        "std::optional<std::vector<std::variant<int, std::string, glm::dvec3>>>",
+        "std::map<std::string, float>",
+        "std::optional<std::vector<std::variant<bool, double, glm::ivec2>>>",
+        "glm::dmat4x4"
+    };
+
+    // Optional parameters have to come last, so the optional type is the last one
+    constexpr std::array<std::string_view, 6> ParameterTypes = {
+        "int",
+        "double",
+        "std::string",
+        "std::vector<glm::dvec3>",
+        "std::variant<int, std::string>",
+        "std::optional<bool>"
+    };
+
+    void writeStruct(std::string& result, int index, int nMembers) {
+        std::format_to(
+            std::back_inserter(result),
+            "// Documentation of the struct {0} that is long enough to be split over\n"
+            "// multiple lines in the same way as the documentation of real structs\n"
+            "struct [[codegen::Dictionary(BenchmarkStruct{0})]] Parameters{0} {{\n",
+            index
+        );
+        for (int i = 0; i < nMembers; i++) {
+            const std::string_view type = MemberTypes[i % MemberTypes.size()];
+            std::format_to(
+                std::back_inserter(result),
+                "    // The documentation of member {0} of type {1}\n"
+                "    {1} member{0}{2};\n\n",
+                i, type, type == "int" ? " [[codegen::inrange(0, 100)]]" : ""
+            );
+        }
+        result += "};\n\n";
+    }
+
+    void writeEnum(std::string& result, int nValues) {
+        result += "enum class [[codegen::stringify()]] Mode {\n";
+        for (int i = 0; i < nValues; i++) {
+            std::format_to(std::back_inserter(result), "    Value{},\n", i);
+        }
+        result += "};\n\n";
+    }
+
+    void writeFunction(std::string& result, int index) {
+        std::format_to(
+            std::back_inserter(result),
+            "/**\n"
+            " * Documentation of the function {0}\n"
+            " */\n"
+            "[[codegen::luawrap]] int function{0}(",
+            index
+        );
+        // Every function gets a different number of parameters
+        const int nParameters = index % static_cast<int>(ParameterTypes.size()) + 1;
+        for (int i = 0; i < nParameters; i++) {
+            std::format_to(
+                std::back_inserter(result),
+                "{}{} p{}", i > 0 ? ", " : "", ParameterTypes[i], i
+            );
+        }
+        std::format_to(std::back_inserter(result), ") {{\n    return {};\n}}\n\n", index);
+    }
+} // namespace
+
+std::vector<std::string> generateCorpus(const CorpusSettings& settings) {
+    std::vector<std::string> res;
+    res.reserve(settings.nFiles);
+    for (int i = 0; i < settings.nFiles; i++) {
+        std::string file = "#include <openspace/documentation/documentation.h>\n\n";
+        for (int j = 0; j < settings.nStructs; j++) {
+            writeStruct(file, j, settings.nMembers);
+        }
+        if (settings.nEnumValues > 0) {
+            writeEnum(file, settings.nEnumValues);
+        }
+        for (int j = 0; j < settings.nFunctions; j++) {
+            writeFunction(file, j);
+        }
+        res.push_back(std::move(file));
+    }
+    return res;
+}
@@ -0,0 +1,54 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CODEGEN___CORPUS___H__
+#define __OPENSPACE_CODEGEN___CORPUS___H__
+
+#include <string>
+#include <vector>
+
+/**
+ * Determines the size of the synthetic corpus that is used by the benchmarks. Every file
+ * contains `nStructs` structs with `nMembers` members each, a single enum with
+ * `nEnumValues` values, and `nFunctions` Lua wrapper functions.
+ */
+struct CorpusSettings {
+    int nFiles = 50;
+    int nStructs = 10;
+    int nMembers = 20;
+    int nEnumValues = 200;
+    int nFunctions = 20;
+};
+
+// The settings that are used by all benchmarks, which can be changed on the command line
+extern CorpusSettings BenchmarkCorpus;
+
+/**
+ * Returns the source code for each of the files of the corpus described by the
+ * \p settings. The content only depends on the \p settings, so repeated calls return the
+ * same sources.
+ */
+std::vector<std::string> generateCorpus(const CorpusSettings& settings);
+
+#endif // __OPENSPACE_CODEGEN___CORPUS___H__
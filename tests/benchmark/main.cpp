@@ -0,0 +1,54 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_session.hpp>
+
+#include "corpus.h"
+
+CorpusSettings BenchmarkCorpus;
+
+int main(int argc, char** argv) {
+    using Catch::Clara::Opt;
+
+    Catch::Session session;
+    session.cli(
+        session.cli() |
+        Opt(BenchmarkCorpus.nFiles, "n")["--files"]
+            ("The number of generated source files") |
+        Opt(BenchmarkCorpus.nStructs, "n")["--structs"]
+            ("The number of structs in each source file") |
+        Opt(BenchmarkCorpus.nMembers, "n")["--members"]
+            ("The number of members in each struct") |
+        Opt(BenchmarkCorpus.nEnumValues, "n")["--enum-values"]
+            ("The number of values of the enum in each source file") |
+        Opt(BenchmarkCorpus.nFunctions, "n")["--functions"]
+            ("The number of Lua wrapper functions in each source file")
+    );
+
+    const int res = session.applyCommandLine(argc, argv);
+    if (res != 0) {
+        return res;
+    }
+    return session.run();
+}
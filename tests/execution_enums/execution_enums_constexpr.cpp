@@ -0,0 +1,77 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <ghoul/misc/dictionary.h>
+#include <array>
+#include <optional>
+#include <variant>
+#include <vector>
+
+namespace {
+    enum class [[codegen::stringify(), codegen::arrayify(), codegen::constexpr()]] Enum1 {
+        Value1,
+        Value2 [[codegen::key("KeyForValue2")]],
+        Value3
+    };
+
+    enum class [[codegen::map(Enum1), codegen::constexpr()]] Enum2 {
+        Value1,
+        Value2,
+        Value3
+    };
+} // namespace
+#include "execution_enums_constexpr_codegen.cpp"
+
+TEST_CASE("Execution/Enums/Constexpr:  To String", "[Execution][Enums]") {
+    static_assert(codegen::toString(Enum1::Value1) == "Value1");
+    static_assert(codegen::toString(Enum1::Value2) == "KeyForValue2");
+    static_assert(codegen::toString(Enum1::Value3) == "Value3");
+    CHECK(codegen::toString(Enum1::Value2) == "KeyForValue2");
+}
+
+TEST_CASE("Execution/Enums/Constexpr:  From String", "[Execution][Enums]") {
+    static_assert(codegen::fromString<Enum1>("Value1") == Enum1::Value1);
+    static_assert(codegen::fromString<Enum1>("KeyForValue2") == Enum1::Value2);
+    static_assert(codegen::fromString<Enum1>("Value3") == Enum1::Value3);
+    CHECK(codegen::fromString<Enum1>("Value3") == Enum1::Value3);
+}
+
+TEST_CASE("Execution/Enums/Constexpr:  Arrayify", "[Execution][Enums]") {
+    constexpr std::array<Enum1, 3> arr = codegen::arrayify<Enum1>();
+    static_assert(arr[0] == Enum1::Value1);
+    static_assert(arr[1] == Enum1::Value2);
+    static_assert(arr[2] == Enum1::Value3);
+    CHECK(arr.size() == 3);
+}
+
+TEST_CASE("Execution/Enums/Constexpr:  Map", "[Execution][Enums]") {
+    static_assert(codegen::map<Enum1>(Enum2::Value1) == Enum1::Value1);
+    static_assert(codegen::map<Enum1>(Enum2::Value2) == Enum1::Value2);
+    static_assert(codegen::map<Enum1>(Enum2::Value3) == Enum1::Value3);
+    CHECK(codegen::map<Enum1>(Enum2::Value2) == Enum1::Value2);
+}
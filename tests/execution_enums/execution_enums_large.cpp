@@ -0,0 +1,124 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <ghoul/misc/dictionary.h>
+#include <optional>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+namespace {
+    // Enums with this many elements use a switch-based lookup in the generated code
+    enum class [[codegen::stringify()]] Large {
+        Alpha,
+        Beta,
+        Gamma,
+        Delta,
+        Epsilon,
+        Zeta,
+        Eta,
+        Theta,
+        Iota,
+        Kappa,
+        Abc [[codegen::key("abc")]],
+        Abd [[codegen::key("abd")]],
+        Xbc [[codegen::key("xbc")]],
+        Empty [[codegen::key("")]]
+    };
+
+    struct [[codegen::Dictionary(LargeEnums)]] Parameters {
+        enum class Inner {
+            A,
+            B,
+            C,
+            D,
+            E,
+            F,
+            G,
+            H,
+            Aa,
+            Ab
+        };
+        // inner documentation
+        Inner inner;
+
+        // innerVector documentation
+        std::vector<Inner> innerVector;
+    };
+} // namespace
+#include "execution_enums_large_codegen.cpp"
+
+TEST_CASE("Execution/Enums/Large:  From String", "[Execution][Enums]") {
+    CHECK(codegen::fromString<Large>("Alpha") == Large::Alpha);
+    CHECK(codegen::fromString<Large>("Beta") == Large::Beta);
+    CHECK(codegen::fromString<Large>("Gamma") == Large::Gamma);
+    CHECK(codegen::fromString<Large>("Delta") == Large::Delta);
+    CHECK(codegen::fromString<Large>("Epsilon") == Large::Epsilon);
+    CHECK(codegen::fromString<Large>("Zeta") == Large::Zeta);
+    CHECK(codegen::fromString<Large>("Eta") == Large::Eta);
+    CHECK(codegen::fromString<Large>("Theta") == Large::Theta);
+    CHECK(codegen::fromString<Large>("Iota") == Large::Iota);
+    CHECK(codegen::fromString<Large>("Kappa") == Large::Kappa);
+    CHECK(codegen::fromString<Large>("abc") == Large::Abc);
+    CHECK(codegen::fromString<Large>("abd") == Large::Abd);
+    CHECK(codegen::fromString<Large>("xbc") == Large::Xbc);
+    CHECK(codegen::fromString<Large>("") == Large::Empty);
+
+    CHECK_THROWS_AS(codegen::fromString<Large>("Alph"), std::runtime_error);
+    CHECK_THROWS_AS(codegen::fromString<Large>("Betb"), std::runtime_error);
+    CHECK_THROWS_AS(codegen::fromString<Large>("abe"), std::runtime_error);
+    CHECK_THROWS_AS(codegen::fromString<Large>("Omega"), std::runtime_error);
+}
+
+TEST_CASE("Execution/Enums/Large:  To String", "[Execution][Enums]") {
+    CHECK(codegen::toString(Large::Alpha) == "Alpha");
+    CHECK(codegen::toString(Large::Kappa) == "Kappa");
+    CHECK(codegen::toString(Large::Abd) == "abd");
+    CHECK(codegen::toString(Large::Empty) == "");
+}
+
+TEST_CASE("Execution/Enums/Large:  Bake", "[Execution][Enums]") {
+    using namespace std::string_literals;
+
+    ghoul::Dictionary d;
+    d.setValue("Inner", "Ab"s);
+    {
+        ghoul::Dictionary e;
+        e.setValue("1", "A"s);
+        e.setValue("2", "H"s);
+        e.setValue("3", "Aa"s);
+        d.setValue("InnerVector", e);
+    }
+
+    const Parameters p = codegen::bake<Parameters>(d);
+    CHECK(p.inner == Parameters::Inner::Ab);
+    REQUIRE(p.innerVector.size() == 3);
+    CHECK(p.innerVector[0] == Parameters::Inner::A);
+    CHECK(p.innerVector[1] == Parameters::Inner::H);
+    CHECK(p.innerVector[2] == Parameters::Inner::Aa);
+}
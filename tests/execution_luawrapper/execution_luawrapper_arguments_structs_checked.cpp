@@ -0,0 +1,148 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <openspace/scripting/lualibrary.h>
+#include <ghoul/lua/lua_helper.h>
+#include <ghoul/misc/dictionary.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+using Function = openspace::LuaLibrary::Function;
+
+namespace {
+    // This struct is read directly from the Lua table
+    struct [[codegen::Dictionary(Checked)]] Checked {
+        int a [[codegen::inrange(1, 5)]];
+        std::optional<std::string> b [[codegen::inlist("x", "y")]];
+        bool c;
+    };
+
+    // This struct is converted into a ghoul::Dictionary first as the vector can't be
+    // checked inline
+    struct [[codegen::Dictionary(Unchecked)]] Unchecked {
+        std::vector<int> a;
+    };
+
+    [[codegen::luawrap]] int funcChecked(Checked p) {
+        return p.a + (p.b.has_value() ? 10 : 0) + (p.c ? 100 : 0);
+    }
+
+    [[codegen::luawrap]] int funcUnchecked(Unchecked p) {
+        return static_cast<int>(p.a.size());
+    }
+} // namespace
+#include "execution_luawrapper_arguments_structs_checked_codegen.cpp"
+
+namespace {
+    int callChecked(const ghoul::Dictionary& p) {
+        // The state has to be closed even if the function throws
+        std::unique_ptr<lua_State, decltype(&lua_close)> state(
+            luaL_newstate(),
+            &lua_close
+        );
+        ghoul::lua::push(state.get(), p);
+        codegen::lua::FuncChecked.function(state.get());
+        const int res = ghoul::lua::value<int>(state.get());
+        CHECK(lua_gettop(state.get()) == 0);
+        return res;
+    }
+} // namespace
+
+TEST_CASE(
+    "Execution/LuaWrapper/Arguments-Structs-Checked:  Valid",
+    "[Execution][LuaWrapper]"
+)
+{
+    using namespace std::string_literals;
+
+    ghoul::Dictionary p;
+    p.setValue("A", 3);
+    p.setValue("C", true);
+    CHECK(callChecked(p) == 103);
+
+    p.setValue("B", "x"s);
+    CHECK(callChecked(p) == 113);
+
+    // Integral doubles are accepted for integer values
+    p.setValue("A", 4.0);
+    CHECK(callChecked(p) == 114);
+
+    // Unknown keys are ignored
+    p.setValue("D", "unused"s);
+    CHECK(callChecked(p) == 114);
+}
+
+TEST_CASE(
+    "Execution/LuaWrapper/Arguments-Structs-Checked:  Invalid",
+    "[Execution][LuaWrapper]"
+)
+{
+    using namespace std::string_literals;
+
+    ghoul::Dictionary p;
+    p.setValue("A", 3);
+    p.setValue("B", "z"s);
+    p.setValue("C", true);
+    CHECK_THROWS(callChecked(p));
+
+    p.setValue("B", "y"s);
+    p.setValue("A", 6);
+    CHECK_THROWS(callChecked(p));
+
+    p.setValue("A", 2.5);
+    CHECK_THROWS(callChecked(p));
+
+    p.setValue("A", 2);
+    p.setValue("C", 1);
+    CHECK_THROWS(callChecked(p));
+
+    ghoul::Dictionary q;
+    q.setValue("A", 2);
+    CHECK_THROWS(callChecked(q));
+}
+
+TEST_CASE(
+    "Execution/LuaWrapper/Arguments-Structs-Checked:  Unchecked",
+    "[Execution][LuaWrapper]"
+)
+{
+    ghoul::Dictionary a;
+    a.setValue("1", 1);
+    a.setValue("2", 2);
+    ghoul::Dictionary p;
+    p.setValue("A", a);
+
+    lua_State* state = luaL_newstate();
+    ghoul::lua::push(state, p);
+    codegen::lua::FuncUnchecked.function(state);
+    CHECK(ghoul::lua::value<int>(state) == 2);
+    CHECK(lua_gettop(state) == 0);
+    lua_close(state);
+}
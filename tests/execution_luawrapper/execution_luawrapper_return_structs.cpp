@@ -0,0 +1,167 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <openspace/scripting/lualibrary.h>
+#include <ghoul/lua/lua_helper.h>
+#include <ghoul/misc/dictionary.h>
+#include <map>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace {
+    struct [[codegen::Dictionary(Parameter)]] Parameter {
+        struct Sub {
+            int value;
+        };
+
+        int a;
+        std::optional<std::string> b;
+        Sub c;
+        std::vector<Sub> d;
+    };
+
+    Parameter parameter(int a) {
+        Parameter p;
+        p.a = a;
+        p.c.value = a + 1;
+        p.d = { Parameter::Sub{ a + 2 }, Parameter::Sub{ a + 3 } };
+        return p;
+    }
+
+    [[codegen::luawrap]] Parameter returnStruct() {
+        return parameter(1);
+    }
+
+    [[codegen::luawrap]] std::vector<Parameter> returnStructVector() {
+        return { parameter(1), parameter(2), parameter(3) };
+    }
+
+    [[codegen::luawrap]] std::map<std::string, Parameter> returnStructMap() {
+        return { { "x", parameter(1) }, { "y", parameter(2) } };
+    }
+
+    [[codegen::luawrap]] std::optional<Parameter> returnStructOptional(bool hasValue) {
+        return hasValue ? std::optional<Parameter>(parameter(1)) : std::nullopt;
+    }
+
+    [[codegen::luawrap]] std::variant<int, std::vector<Parameter>> returnStructVariant(
+                                                                            bool isStruct)
+    {
+        if (isStruct) {
+            return std::vector<Parameter>{ parameter(1) };
+        }
+        else {
+            return 5;
+        }
+    }
+} // namespace
+#include "execution_luawrapper_return_structs_codegen.cpp"
+
+namespace {
+    void checkParameter(const ghoul::Dictionary& d, int a) {
+        REQUIRE(d.hasValue<double>("a"));
+        CHECK(d.value<double>("a") == a);
+        CHECK(!d.hasKey("b"));
+        REQUIRE(d.hasValue<ghoul::Dictionary>("c"));
+        CHECK(d.value<ghoul::Dictionary>("c").value<double>("value") == a + 1);
+        REQUIRE(d.hasValue<ghoul::Dictionary>("d"));
+        const ghoul::Dictionary v = d.value<ghoul::Dictionary>("d");
+        REQUIRE(v.size() == 2);
+        CHECK(v.value<ghoul::Dictionary>("1").value<double>("value") == a + 2);
+        CHECK(v.value<ghoul::Dictionary>("2").value<double>("value") == a + 3);
+    }
+} // namespace
+
+TEST_CASE("Execution/LuaWrapper/Return-Structs:  Struct", "[Execution][LuaWrapper]") {
+    lua_State* state = luaL_newstate();
+    REQUIRE(state);
+    codegen::lua::ReturnStruct.function(state);
+    REQUIRE(lua_gettop(state) == 1);
+    checkParameter(ghoul::lua::value<ghoul::Dictionary>(state), 1);
+    lua_close(state);
+}
+
+TEST_CASE("Execution/LuaWrapper/Return-Structs:  Vector", "[Execution][LuaWrapper]") {
+    lua_State* state = luaL_newstate();
+    REQUIRE(state);
+    codegen::lua::ReturnStructVector.function(state);
+    REQUIRE(lua_gettop(state) == 1);
+    const ghoul::Dictionary d = ghoul::lua::value<ghoul::Dictionary>(state);
+    REQUIRE(d.size() == 3);
+    checkParameter(d.value<ghoul::Dictionary>("1"), 1);
+    checkParameter(d.value<ghoul::Dictionary>("2"), 2);
+    checkParameter(d.value<ghoul::Dictionary>("3"), 3);
+    lua_close(state);
+}
+
+TEST_CASE("Execution/LuaWrapper/Return-Structs:  Map", "[Execution][LuaWrapper]") {
+    lua_State* state = luaL_newstate();
+    REQUIRE(state);
+    codegen::lua::ReturnStructMap.function(state);
+    REQUIRE(lua_gettop(state) == 1);
+    const ghoul::Dictionary d = ghoul::lua::value<ghoul::Dictionary>(state);
+    REQUIRE(d.size() == 2);
+    checkParameter(d.value<ghoul::Dictionary>("x"), 1);
+    checkParameter(d.value<ghoul::Dictionary>("y"), 2);
+    lua_close(state);
+}
+
+TEST_CASE("Execution/LuaWrapper/Return-Structs:  Optional", "[Execution][LuaWrapper]") {
+    lua_State* state = luaL_newstate();
+    REQUIRE(state);
+
+    ghoul::lua::push(state, true);
+    codegen::lua::ReturnStructOptional.function(state);
+    REQUIRE(lua_gettop(state) == 1);
+    checkParameter(ghoul::lua::value<ghoul::Dictionary>(state), 1);
+
+    ghoul::lua::push(state, false);
+    codegen::lua::ReturnStructOptional.function(state);
+    CHECK(lua_gettop(state) == 0);
+    lua_close(state);
+}
+
+TEST_CASE("Execution/LuaWrapper/Return-Structs:  Variant", "[Execution][LuaWrapper]") {
+    lua_State* state = luaL_newstate();
+    REQUIRE(state);
+
+    ghoul::lua::push(state, true);
+    codegen::lua::ReturnStructVariant.function(state);
+    REQUIRE(lua_gettop(state) == 1);
+    const ghoul::Dictionary d = ghoul::lua::value<ghoul::Dictionary>(state);
+    REQUIRE(d.size() == 1);
+    checkParameter(d.value<ghoul::Dictionary>("1"), 1);
+
+    ghoul::lua::push(state, false);
+    codegen::lua::ReturnStructVariant.function(state);
+    REQUIRE(lua_gettop(state) == 1);
+    CHECK(ghoul::lua::value<int>(state) == 5);
+    lua_close(state);
+}
@@ -0,0 +1,119 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <ghoul/misc/dictionary.h>
+#include <execution>
+#include <string>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    struct [[codegen::Dictionary(BakeMany), codegen::bakemany()]] Parameters {
+        // value documentation
+        int value;
+
+        // name documentation
+        std::string name;
+    };
+} // namespace
+#include "execution_structs_bakemany_codegen.cpp"
+
+namespace {
+    std::vector<ghoul::Dictionary> dictionaries(int n) {
+        std::vector<ghoul::Dictionary> res;
+        for (int i = 0; i < n; i++) {
+            ghoul::Dictionary d;
+            d.setValue("Value", i);
+            d.setValue("Name", "name" + std::to_string(i));
+            res.push_back(d);
+        }
+        return res;
+    }
+} // namespace
+
+TEST_CASE("Execution/Structs/BakeMany:  Bake", "[Execution][Structs]") {
+    const std::vector<ghoul::Dictionary> ds = dictionaries(100);
+
+    const std::vector<Parameters> ps = codegen::bakeMany<Parameters>(ds);
+    REQUIRE(ps.size() == 100);
+    for (int i = 0; i < 100; i++) {
+        CHECK(ps[i].value == i);
+        CHECK(ps[i].name == "name" + std::to_string(i));
+    }
+}
+
+TEST_CASE("Execution/Structs/BakeMany:  Bake policy", "[Execution][Structs]") {
+    const std::vector<ghoul::Dictionary> ds = dictionaries(100);
+
+    const std::vector<Parameters> ps =
+        codegen::bakeMany<Parameters>(std::execution::seq, ds);
+    REQUIRE(ps.size() == 100);
+    for (int i = 0; i < 100; i++) {
+        CHECK(ps[i].value == i);
+        CHECK(ps[i].name == "name" + std::to_string(i));
+    }
+}
+
+// libstdc++ implements the parallel policies with TBB, which has to be linked in
+#if !defined(__GLIBCXX__) || defined(CODEGEN_TEST_HAS_TBB)
+TEST_CASE("Execution/Structs/BakeMany:  Bake parallel", "[Execution][Structs]") {
+    const std::vector<ghoul::Dictionary> ds = dictionaries(100);
+
+    const std::vector<Parameters> ps =
+        codegen::bakeMany<Parameters>(std::execution::par, ds);
+    REQUIRE(ps.size() == 100);
+    for (int i = 0; i < 100; i++) {
+        CHECK(ps[i].value == i);
+        CHECK(ps[i].name == "name" + std::to_string(i));
+    }
+}
+#endif // !defined(__GLIBCXX__) || defined(CODEGEN_TEST_HAS_TBB)
+
+TEST_CASE("Execution/Structs/BakeMany:  Empty", "[Execution][Structs]") {
+    const std::vector<Parameters> ps = codegen::bakeMany<Parameters>({});
+    CHECK(ps.empty());
+}
+
+TEST_CASE("Execution/Structs/BakeMany:  Errors", "[Execution][Structs]") {
+    std::vector<ghoul::Dictionary> ds = dictionaries(10);
+    ds[7].setValue("Value", std::string("abc"));
+    ds[2] = ghoul::Dictionary();
+
+    try {
+        codegen::bakeMany<Parameters>(ds);
+        FAIL("Expected BakeManyError");
+    }
+    catch (const codegen::BakeManyError& e) {
+        REQUIRE(e.errors.size() == 2);
+        CHECK(e.errors[0].index == 2);
+        CHECK_THROWS_AS(std::rethrow_exception(e.errors[0].exception), SpecificationError);
+        CHECK(e.errors[1].index == 7);
+        CHECK_THROWS_AS(std::rethrow_exception(e.errors[1].exception), SpecificationError);
+    }
+}
@@ -28,6 +28,7 @@
 #include <openspace/documentation/verifier.h>
 #include <ghoul/misc/dictionary.h>
 #include <optional>
+#include <string>
 #include <variant>
 #include <vector>
 
@@ -122,6 +123,30 @@ namespace {
 } // namespace
 #include "execution_structs_comments_codegen.cpp"
 
+namespace {
+    ghoul::Dictionary validDictionary() {
+        ghoul::Dictionary d;
+        d.setValue("MultiLineCommenting", 1.0);
+        d.setValue("MultiLineSimpleVariableDef", 2.5);
+        d.setValue("MultiLineCommentAndDef", std::string("abc"));
+        d.setValue("MisalignedIndent", true);
+        d.setValue("MultiLineCommentAttribute", 2.0);
+        d.setValue("Multilineinlist", std::string("Very"));
+        d.setValue("NewLineAnnotation", std::string("def"));
+        d.setValue("NewLine2Annotation", std::string("ghi"));
+        {
+            ghoul::Dictionary e;
+            e.setValue("1", std::string("jkl"));
+            d.setValue("QuoteInComment", e);
+        }
+        d.setValue("TwoQuotesInComment", 3.0);
+        d.setValue("VerbatimComment", 4.0);
+        d.setValue("VerbatimAndDirectComment", 5.0);
+        d.setValue("DirectAndVerbatimComment", 6.0);
+        d.setValue("SandwichedComment", 7.0);
+        return d;
+    }
+} // namespace
 
 TEST_CASE("Execution/Structs/Comments", "[Execution][Structs]") {
     using namespace openspace;
@@ -164,3 +189,59 @@ TEST_CASE("Execution/Structs/Comments", "[Execution][Structs]") {
         "direct comment 1 Verbatim Comment direct comment 2"
     );
 }
+
+TEST_CASE("Execution/Structs/Comments:  Bake", "[Execution][Structs]") {
+    using namespace openspace;
+
+    // The bake function creates its documentation without the descriptions, which must
+    // not change the verification or the documentation that is returned by doc<T>
+    const Parameters p = codegen::bake<Parameters>(validDictionary());
+    CHECK(p.multiLineCommenting == 1);
+    CHECK(p.multiLineSimpleVariableDef == 2.5f);
+    CHECK(p.multiLineCommentAndDef == "abc");
+    CHECK(p.misalignedIndent);
+    CHECK(p.multiLineCommentAttribute == 2);
+    CHECK(p.multilineinlist == "Very");
+    CHECK(p.newLineAnnotation == "def");
+    CHECK(p.newLine2Annotation == "ghi");
+    CHECK(p.quoteInComment == std::vector<std::string>{ "jkl" });
+    CHECK(p.twoQuotesInComment == 3);
+    CHECK(p.verbatimComment == 4);
+    CHECK(p.verbatimAndDirectComment == 5);
+    CHECK(p.directAndVerbatimComment == 6);
+    CHECK(p.sandwichedComment == 7);
+
+    Documentation d = codegen::doc<Parameters>("abc");
+    REQUIRE(d.entries.size() == 14);
+    CHECK(d.entries[0].documentation == "multi line commenting");
+    CHECK(d.entries[10].documentation == "Verbatim Comment");
+    CHECK(
+        d.entries[13].documentation ==
+        "direct comment 1 Verbatim Comment direct comment 2"
+    );
+}
+
+TEST_CASE("Execution/Structs/Comments:  Bake errors", "[Execution][Structs]") {
+    using namespace openspace;
+
+    ghoul::Dictionary dict = validDictionary();
+    dict.setValue("MultiLineCommentAttribute", 5.0);
+    dict.removeValue("TwoQuotesInComment");
+
+    try {
+        codegen::bake<Parameters>(dict);
+        FAIL("Expected SpecificationError");
+    }
+    catch (const SpecificationError& e) {
+        REQUIRE(e.result.offenses.size() == 2);
+        CHECK(e.result.offenses[0].offender == "MultiLineCommentAttribute");
+        CHECK(e.result.offenses[0].reason == TestResult::Offense::Reason::Verification);
+        CHECK(e.result.offenses[1].offender == "TwoQuotesInComment");
+        CHECK(e.result.offenses[1].reason == TestResult::Offense::Reason::MissingKey);
+    }
+
+    Documentation d = codegen::doc<Parameters>("abc");
+    REQUIRE(d.entries.size() == 14);
+    CHECK(d.entries[4].documentation == "multiline comment with attribute");
+    CHECK(d.entries[9].documentation == "What about \" second quote \" though?");
+}
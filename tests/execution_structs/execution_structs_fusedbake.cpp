@@ -0,0 +1,207 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <ghoul/misc/dictionary.h>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    struct [[codegen::Dictionary(Regular)]] Parameters {
+        // intValue documentation
+        int intValue [[codegen::inrange(1, 5)]];
+
+        // doubleValue documentation
+        std::optional<double> doubleValue [[codegen::less(10.0)]];
+
+        // floatValue documentation
+        float floatValue [[codegen::greater(0.5)]];
+
+        // boolValue documentation
+        bool boolValue;
+
+        // stringValue documentation
+        std::string stringValue [[codegen::inlist("abc", "def")]];
+
+        // optionalStringValue documentation
+        std::optional<std::string> optionalStringValue [[codegen::notempty()]];
+
+        // vectorValue documentation
+        std::vector<int> vectorValue;
+    };
+
+    struct [[codegen::Dictionary(Fused), codegen::fusedbake()]] FusedParameters {
+        // intValue documentation
+        int intValue [[codegen::inrange(1, 5)]];
+
+        // doubleValue documentation
+        std::optional<double> doubleValue [[codegen::less(10.0)]];
+
+        // floatValue documentation
+        float floatValue [[codegen::greater(0.5)]];
+
+        // boolValue documentation
+        bool boolValue;
+
+        // stringValue documentation
+        std::string stringValue [[codegen::inlist("abc", "def")]];
+
+        // optionalStringValue documentation
+        std::optional<std::string> optionalStringValue [[codegen::notempty()]];
+
+        // vectorValue documentation
+        std::vector<int> vectorValue;
+    };
+} // namespace
+#include "execution_structs_fusedbake_codegen.cpp"
+
+namespace {
+    ghoul::Dictionary validDictionary() {
+        ghoul::Dictionary d;
+        d.setValue("IntValue", 3.0);
+        d.setValue("DoubleValue", 2.5);
+        d.setValue("FloatValue", 1.5);
+        d.setValue("BoolValue", true);
+        d.setValue("StringValue", std::string("def"));
+        {
+            ghoul::Dictionary e;
+            e.setValue("1", 1);
+            e.setValue("2", 2);
+            d.setValue("VectorValue", e);
+        }
+        return d;
+    }
+
+    // Bakes the dictionary with both the regular and the fused bake function and returns
+    // the error messages if they failed
+    std::pair<std::string, std::string> errors(const ghoul::Dictionary& d) {
+        std::string regular;
+        try {
+            codegen::bake<Parameters>(d);
+        }
+        catch (const SpecificationError& e) {
+            regular = e.what();
+        }
+
+        std::string fused;
+        try {
+            codegen::bake<FusedParameters>(d);
+        }
+        catch (const SpecificationError& e) {
+            fused = e.what();
+        }
+        return { regular, fused };
+    }
+} // namespace
+
+TEST_CASE("Execution/Structs/FusedBake:  Bake", "[Execution][Structs]") {
+    const ghoul::Dictionary d = validDictionary();
+
+    const FusedParameters p = codegen::bake<FusedParameters>(d);
+    CHECK(p.intValue == 3);
+    REQUIRE(p.doubleValue.has_value());
+    CHECK(*p.doubleValue == 2.5);
+    CHECK(p.floatValue == 1.5f);
+    CHECK(p.boolValue);
+    CHECK(p.stringValue == "def");
+    CHECK(!p.optionalStringValue.has_value());
+    CHECK(p.vectorValue == std::vector<int>{ 1, 2 });
+}
+
+TEST_CASE("Execution/Structs/FusedBake:  Bake optional", "[Execution][Structs]") {
+    ghoul::Dictionary d = validDictionary();
+    d.removeValue("DoubleValue");
+    d.setValue("OptionalStringValue", std::string("ghi"));
+
+    const FusedParameters p = codegen::bake<FusedParameters>(d);
+    CHECK(!p.doubleValue.has_value());
+    REQUIRE(p.optionalStringValue.has_value());
+    CHECK(*p.optionalStringValue == "ghi");
+}
+
+TEST_CASE("Execution/Structs/FusedBake:  Errors", "[Execution][Structs]") {
+    {
+        ghoul::Dictionary d = validDictionary();
+        d.setValue("IntValue", 6.0);
+        const auto [regular, fused] = errors(d);
+        CHECK(!regular.empty());
+        CHECK(regular == fused);
+    }
+    {
+        ghoul::Dictionary d = validDictionary();
+        d.setValue("IntValue", 2.5);
+        const auto [regular, fused] = errors(d);
+        CHECK(!regular.empty());
+        CHECK(regular == fused);
+    }
+    {
+        ghoul::Dictionary d = validDictionary();
+        d.setValue("DoubleValue", 10.0);
+        const auto [regular, fused] = errors(d);
+        CHECK(!regular.empty());
+        CHECK(regular == fused);
+    }
+    {
+        ghoul::Dictionary d = validDictionary();
+        d.setValue("FloatValue", 0.25);
+        const auto [regular, fused] = errors(d);
+        CHECK(!regular.empty());
+        CHECK(regular == fused);
+    }
+    {
+        ghoul::Dictionary d = validDictionary();
+        d.removeValue("BoolValue");
+        const auto [regular, fused] = errors(d);
+        CHECK(!regular.empty());
+        CHECK(regular == fused);
+    }
+    {
+        ghoul::Dictionary d = validDictionary();
+        d.setValue("StringValue", std::string("ghi"));
+        const auto [regular, fused] = errors(d);
+        CHECK(!regular.empty());
+        CHECK(regular == fused);
+    }
+    {
+        ghoul::Dictionary d = validDictionary();
+        d.setValue("OptionalStringValue", std::string());
+        const auto [regular, fused] = errors(d);
+        CHECK(!regular.empty());
+        CHECK(regular == fused);
+    }
+    {
+        ghoul::Dictionary d = validDictionary();
+        d.setValue("VectorValue", std::string("abc"));
+        const auto [regular, fused] = errors(d);
+        CHECK(!regular.empty());
+        CHECK(regular == fused);
+    }
+}
@@ -0,0 +1,112 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <ghoul/misc/dictionary.h>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace {
+    struct [[codegen::Dictionary(LargeVector)]] Parameters {
+        // intVector documentation
+        std::vector<int> intVector;
+
+        // boolVector documentation
+        std::vector<bool> boolVector;
+
+        // intArray documentation
+        std::array<int, 128> intArray;
+    };
+} // namespace
+#include "execution_structs_large_vector_codegen.cpp"
+
+TEST_CASE("Execution/Structs/LargeVector:  Bake", "[Execution][Structs]") {
+    constexpr int NVector = 100000;
+    constexpr int NArray = 128;
+
+    ghoul::Dictionary d;
+    {
+        ghoul::Dictionary e;
+        for (int i = 1; i <= NVector; i++) {
+            e.setValue(std::to_string(i), i);
+        }
+        d.setValue("IntVector", e);
+    }
+    {
+        ghoul::Dictionary e;
+        for (int i = 1; i <= NVector; i++) {
+            e.setValue(std::to_string(i), i % 3 == 0);
+        }
+        d.setValue("BoolVector", e);
+    }
+    {
+        ghoul::Dictionary e;
+        for (int i = 1; i <= NArray; i++) {
+            e.setValue(std::to_string(i), 2 * i);
+        }
+        d.setValue("IntArray", e);
+    }
+
+    const Parameters p = codegen::bake<Parameters>(d);
+    REQUIRE(p.intVector.size() == NVector);
+    for (int i = 0; i < NVector; i++) {
+        CHECK(p.intVector[i] == i + 1);
+    }
+    REQUIRE(p.boolVector.size() == NVector);
+    for (int i = 0; i < NVector; i++) {
+        CHECK(p.boolVector[i] == ((i + 1) % 3 == 0));
+    }
+    for (int i = 0; i < NArray; i++) {
+        CHECK(p.intArray[i] == 2 * (i + 1));
+    }
+}
+
+TEST_CASE("Execution/Structs/LargeVector:  Missing Key", "[Execution][Structs]") {
+    ghoul::Dictionary d;
+    {
+        ghoul::Dictionary e;
+        e.setValue("1", 1);
+        e.setValue("2", 2);
+        e.setValue("4", 4);
+        d.setValue("IntVector", e);
+    }
+    {
+        ghoul::Dictionary e;
+        e.setValue("1", true);
+        d.setValue("BoolVector", e);
+    }
+    {
+        ghoul::Dictionary e;
+        for (int i = 1; i <= 128; i++) {
+            e.setValue(std::to_string(i), i);
+        }
+        d.setValue("IntArray", e);
+    }
+
+    CHECK_THROWS(codegen::bake<Parameters>(d));
+}
@@ -0,0 +1,210 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <ghoul/misc/dictionary.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+namespace {
+    struct [[codegen::Dictionary(Serialize), codegen::serialize()]] Parameters {
+        enum class E {
+            Value1,
+            Value2,
+            Value3
+        };
+
+        struct Sub {
+            // subValue documentation
+            std::vector<std::string> subValue;
+        };
+
+        // boolValue documentation
+        bool boolValue;
+
+        // intValue documentation
+        int intValue;
+
+        // doubleValue documentation
+        double doubleValue;
+
+        // stringValue documentation
+        std::string stringValue;
+
+        // pathValue documentation
+        std::filesystem::path pathValue [[codegen::mustexist(false)]];
+
+        // vecValue documentation
+        glm::dvec3 vecValue;
+
+        // matValue documentation
+        glm::mat2x2 matValue;
+
+        // enumValue documentation
+        E enumValue;
+
+        // optionalValue documentation
+        std::optional<float> optionalValue;
+
+        // emptyOptionalValue documentation
+        std::optional<float> emptyOptionalValue;
+
+        // boolVectorValue documentation
+        std::vector<bool> boolVectorValue;
+
+        // arrayValue documentation
+        std::array<int, 3> arrayValue;
+
+        // mapValue documentation
+        std::map<std::string, Sub> mapValue;
+
+        // variantValue documentation
+        std::variant<int, std::string> variantValue;
+
+        // tupleValue documentation
+        std::tuple<int, std::string, E> tupleValue;
+    };
+
+    struct [[codegen::Dictionary(SerializeOther), codegen::serialize()]] OtherParameters {
+        // value documentation
+        int value;
+    };
+
+    struct [[codegen::Dictionary(SerializeUnusedChild), codegen::serialize()]] UnusedChildParameters {
+        // The child struct can't be serialized, but as it is not used by any member the
+        // root struct can still be serialized
+        struct Unused {
+            // dictionary documentation
+            ghoul::Dictionary dictionary;
+        };
+
+        // value documentation
+        int value;
+    };
+} // namespace
+#include "execution_structs_serialize_codegen.cpp"
+
+namespace {
+    Parameters parameters() {
+        Parameters p;
+        p.boolValue = true;
+        p.intValue = 42;
+        p.doubleValue = 1.5;
+        p.stringValue = "a string that is long enough to not fit into the SSO buffer";
+        p.pathValue = std::filesystem::path(u8"some/p\u00e4th");
+        p.vecValue = glm::dvec3(1.0, 2.0, 3.0);
+        p.matValue = glm::mat2x2(1.f, 2.f, 3.f, 4.f);
+        p.enumValue = Parameters::E::Value2;
+        p.optionalValue = 2.5f;
+        p.boolVectorValue = { true, false, true };
+        p.arrayValue = { 1, 2, 3 };
+        p.mapValue["a"] = Parameters::Sub{ { "x", "y" } };
+        p.mapValue["b"] = Parameters::Sub{ {} };
+        p.variantValue = std::string("variant");
+        p.tupleValue = { 5, "tuple", Parameters::E::Value3 };
+        return p;
+    }
+} // namespace
+
+TEST_CASE("Execution/Structs/Serialize:  Roundtrip", "[Execution][Structs]") {
+    const Parameters p = parameters();
+
+    std::vector<std::byte> buffer;
+    codegen::serialize(p, buffer);
+    REQUIRE(!buffer.empty());
+
+    const Parameters q = codegen::deserialize<Parameters>(buffer);
+    CHECK(q.boolValue == p.boolValue);
+    CHECK(q.intValue == p.intValue);
+    CHECK(q.doubleValue == p.doubleValue);
+    CHECK(q.stringValue == p.stringValue);
+    CHECK(q.pathValue == p.pathValue);
+    CHECK(q.vecValue == p.vecValue);
+    CHECK(q.matValue == p.matValue);
+    CHECK(q.enumValue == p.enumValue);
+    CHECK(q.optionalValue == p.optionalValue);
+    CHECK(!q.emptyOptionalValue.has_value());
+    CHECK(q.boolVectorValue == p.boolVectorValue);
+    CHECK(q.arrayValue == p.arrayValue);
+    REQUIRE(q.mapValue.size() == 2);
+    CHECK(q.mapValue.at("a").subValue == p.mapValue.at("a").subValue);
+    CHECK(q.mapValue.at("b").subValue.empty());
+    CHECK(q.variantValue == p.variantValue);
+    CHECK(q.tupleValue == p.tupleValue);
+}
+
+TEST_CASE("Execution/Structs/Serialize:  Appending", "[Execution][Structs]") {
+    const Parameters p = parameters();
+
+    std::vector<std::byte> buffer1;
+    codegen::serialize(p, buffer1);
+
+    // Serializing into a non-empty buffer appends to it
+    std::vector<std::byte> buffer2 = { std::byte(1), std::byte(2) };
+    codegen::serialize(p, buffer2);
+    REQUIRE(buffer2.size() == buffer1.size() + 2);
+    CHECK(std::equal(buffer1.begin(), buffer1.end(), buffer2.begin() + 2));
+}
+
+TEST_CASE("Execution/Structs/Serialize:  Wrong struct", "[Execution][Structs]") {
+    OtherParameters p;
+    p.value = 5;
+
+    std::vector<std::byte> buffer;
+    codegen::serialize(p, buffer);
+    CHECK(codegen::deserialize<OtherParameters>(buffer).value == 5);
+    CHECK_THROWS_AS(codegen::deserialize<Parameters>(buffer), ghoul::RuntimeError);
+}
+
+TEST_CASE("Execution/Structs/Serialize:  Unused child struct", "[Execution][Structs]") {
+    UnusedChildParameters p;
+    p.value = 5;
+
+    std::vector<std::byte> buffer;
+    codegen::serialize(p, buffer);
+    CHECK(codegen::deserialize<UnusedChildParameters>(buffer).value == 5);
+}
+
+TEST_CASE("Execution/Structs/Serialize:  Truncated", "[Execution][Structs]") {
+    const Parameters p = parameters();
+
+    std::vector<std::byte> buffer;
+    codegen::serialize(p, buffer);
+
+    const std::span<const std::byte> truncated =
+        std::span<const std::byte>(buffer).first(buffer.size() - 1);
+    CHECK_THROWS_AS(codegen::deserialize<Parameters>(truncated), ghoul::RuntimeError);
+}
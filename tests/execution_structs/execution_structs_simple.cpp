@@ -47,6 +47,23 @@ TEST_CASE("Execution/Structs/Simple:  Bake", "[Execution][Structs]") {
     CHECK(p.value == 5.f);
 }
 
+TEST_CASE("Execution/Structs/Simple:  Bake multiple", "[Execution][Structs]") {
+    ghoul::Dictionary d1;
+    d1.setValue("Value", 1.0);
+    const Parameters p1 = codegen::bake<Parameters>(d1);
+    CHECK(p1.value == 1.f);
+
+    ghoul::Dictionary d2;
+    d2.setValue("Value", 2.0);
+    const Parameters p2 = codegen::bake<Parameters>(d2);
+    CHECK(p2.value == 2.f);
+
+    // The cached documentation must still catch errors in subsequent calls
+    ghoul::Dictionary d3;
+    d3.setValue("Value", std::string("abc"));
+    CHECK_THROWS_AS(codegen::bake<Parameters>(d3), SpecificationError);
+}
+
 TEST_CASE("Execution/Structs/Simple:  Documentation", "[Execution][Structs]") {
     Documentation doc = codegen::doc<Parameters>("");
 
@@ -59,3 +76,11 @@ TEST_CASE("Execution/Structs/Simple:  Documentation", "[Execution][Structs]") {
     CHECK(e.verifier->type() == "Double");
     CHECK(dynamic_cast<DoubleVerifier*>(e.verifier.get()));
 }
+
+TEST_CASE("Execution/Structs/Simple:  Documentation copies", "[Execution][Structs]") {
+    Documentation doc1 = codegen::doc<Parameters>("");
+    doc1.entries.clear();
+
+    const Documentation doc2 = codegen::doc<Parameters>("");
+    CHECK(doc2.entries.size() == 1);
+}
@@ -0,0 +1,75 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "codegen.h"
+#include "parsing.h"
+#include "types.h"
+
+TEST_CASE("Parsing/Enums/Constexpr:  Basic", "[Parsing][Enums]") {
+    constexpr std::string_view Source = R"(
+    enum class [[codegen::stringify(), codegen::arrayify(), codegen::constexpr()]] Enum1 {
+        Value1,
+        value2,
+        Value3
+    };
+
+    enum class [[codegen::arrayify()]] Enum2 {
+        Value1,
+        Value2
+    };
+)";
+
+    Code code = parse(Source);
+    CHECK(code.structs.empty());
+    CHECK(code.luaWrapperFunctions.empty());
+    REQUIRE(code.enums.size() == 2);
+
+    {
+        Enum* e = code.enums[0];
+        REQUIRE(e);
+        CHECK(e->name == "Enum1");
+        CHECK(e->attributes.stringify);
+        CHECK(e->attributes.arrayify);
+        CHECK(e->attributes.isConstexpr);
+        REQUIRE(e->elements.size() == 3);
+    }
+    {
+        Enum* e = code.enums[1];
+        REQUIRE(e);
+        CHECK(e->name == "Enum2");
+        CHECK(e->attributes.arrayify);
+        CHECK(!e->attributes.isConstexpr);
+        REQUIRE(e->elements.size() == 2);
+    }
+
+    const std::string r = generateResult(code);
+    CHECK(r.contains("constexpr std::string_view toString<Enum1>(Enum1 t)"));
+    CHECK(r.contains("constexpr Enum1 fromString<Enum1>(std::string_view sv)"));
+    CHECK(r.contains("constexpr auto arrayify<Enum1>()"));
+    CHECK(r.contains("std::array<Enum1, 3>"));
+    CHECK(r.contains("std::vector<Enum2>"));
+    CHECK(!r.contains("constexpr Enum2"));
+}
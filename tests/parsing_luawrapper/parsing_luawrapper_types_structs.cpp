@@ -870,3 +870,43 @@ TEST_CASE(
     const std::string r = generateResult(code);
     CHECK(!r.empty());
 }
+
+TEST_CASE(
+    "Parsing/LuaWrapper/Arguments-Struct:  Direct reader",
+    "[Parsing][LuaWrapper]"
+)
+{
+    constexpr std::string_view Source = R"(
+    struct [[codegen::Dictionary(Checked)]] Checked {
+        int a [[codegen::inrange(1, 5)]];
+        std::optional<std::string> b [[codegen::inlist("x", "y")]];
+        bool c;
+    };
+
+    struct [[codegen::Dictionary(Unchecked)]] Unchecked {
+        std::vector<int> a;
+    };
+
+    [[codegen::luawrap]] int funcChecked(Checked p) {
+        return p.a;
+    }
+
+    [[codegen::luawrap]] int funcUnchecked(Unchecked p) {
+        return static_cast<int>(p.a.size());
+    }
+)";
+
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 2);
+    REQUIRE(code.luaWrapperFunctions.size() == 2);
+
+    // Only the struct whose members can all be checked inline is read directly from the
+    // Lua table, the other one is converted into a ghoul::Dictionary and baked
+    const std::string r = generateResult(code);
+    CHECK(
+        r.find("Checked luaBake<Checked>(lua_State* L, int index)") != std::string::npos
+    );
+    CHECK(r.find("codegen::internal::luaBake<Checked>(L, 1)") != std::string::npos);
+    CHECK(r.find("luaBake<Unchecked>") == std::string::npos);
+    CHECK(r.find("codegen::bake<Unchecked>(") != std::string::npos);
+}
@@ -0,0 +1,248 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_exception.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "codegen.h"
+#include "parsing.h"
+#include "types.h"
+
+namespace CM = Catch::Matchers;
+
+TEST_CASE("Parsing/Mixed/Markers:  Markers in comments", "[Parsing][Mixed]") {
+    constexpr std::string_view Source = R"(
+// struct [[codegen::Dictionary(Commented)]] Commented { int a; };
+/* struct [[codegen::Dictionary(Block)]] Block {
+   }
+*/
+struct [[codegen::Dictionary(Comments)]] Parameters {
+    // value } documentation
+    int value;
+
+    // other { documentation
+    float other;
+};
+
+/* } */
+enum class [[codegen::stringify()]] Enum {
+    A,
+    B
+};
+)";
+
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+    REQUIRE(s);
+    CHECK(s->attributes.dictionary == "Comments");
+    REQUIRE(s->variables.size() == 2);
+    CHECK(s->variables[0]->name == "value");
+    CHECK(s->variables[0]->comment == "value } documentation");
+    CHECK(s->variables[1]->name == "other");
+    CHECK(s->variables[1]->comment == "other { documentation");
+
+    REQUIRE(code.enums.size() == 1);
+    Enum* e = code.enums.front();
+    REQUIRE(e);
+    CHECK(e->name == "Enum");
+    REQUIRE(e->elements.size() == 2);
+    CHECK(e->elements[0]->name == "A");
+    CHECK(e->elements[1]->name == "B");
+}
+
+TEST_CASE("Parsing/Mixed/Markers:  Markers in strings", "[Parsing][Mixed]") {
+    constexpr std::string_view Source = R"code(
+struct [[codegen::Dictionary(Strings)]] Parameters {
+    std::string value [[codegen::inlist("}", "{", "[[codegen::Dictionary(X)")]];
+
+    // other documentation
+    float other;
+};
+
+constexpr std::string_view Text = "struct [[codegen::Dictionary(Wrong)]] Wrong {";
+constexpr char Bracket = '}';
+constexpr std::string_view Raw = R"x(
+struct [[codegen::Dictionary(Raw)]] Raw {
+    }
+)x";
+
+enum class [[codegen::stringify()]] Enum {
+    A
+};
+)code";
+
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+    REQUIRE(s);
+    CHECK(s->attributes.dictionary == "Strings");
+    REQUIRE(s->variables.size() == 2);
+    CHECK(s->variables[0]->name == "value");
+    CHECK(
+        s->variables[0]->attributes.inlist == "\"}\", \"{\", \"[[codegen::Dictionary(X)\""
+    );
+    CHECK(s->variables[1]->name == "other");
+
+    REQUIRE(code.enums.size() == 1);
+    CHECK(code.enums.front()->name == "Enum");
+}
+
+TEST_CASE("Parsing/Mixed/Markers:  Raw string in root struct", "[Parsing][Mixed]") {
+    constexpr std::string_view Source = R"code(
+struct [[codegen::Dictionary(RawStrings)]] Parameters {
+    std::string value [[codegen::inlist(R"(}[[codegen::Dictionary(X)])")]];
+
+    // other documentation
+    float other;
+};
+
+enum class [[codegen::stringify()]] Enum {
+    A
+};
+)code";
+
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+    REQUIRE(s);
+    CHECK(s->attributes.dictionary == "RawStrings");
+    REQUIRE(s->variables.size() == 2);
+    CHECK(s->variables[0]->name == "value");
+    CHECK(s->variables[1]->name == "other");
+
+    REQUIRE(code.enums.size() == 1);
+    CHECK(code.enums.front()->name == "Enum");
+}
+
+TEST_CASE("Parsing/Mixed/Markers:  Digit separator", "[Parsing][Mixed]") {
+    constexpr std::string_view Source = R"(
+struct [[codegen::Dictionary(Separator)]] Parameters {
+    int value [[codegen::inrange(1'000, 10'000)]];
+
+    // other documentation
+    float other;
+};
+
+constexpr int Value = 1'000'000;
+constexpr char Bracket = '{';
+
+enum class [[codegen::stringify()]] Enum {
+    A
+};
+)";
+
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+    REQUIRE(s);
+    REQUIRE(s->variables.size() == 2);
+    CHECK(s->variables[0]->name == "value");
+    CHECK(s->variables[0]->attributes.inrange == "1'000, 10'000");
+    CHECK(s->variables[1]->name == "other");
+
+    REQUIRE(code.enums.size() == 1);
+    CHECK(code.enums.front()->name == "Enum");
+}
+
+TEST_CASE("Parsing/Mixed/Markers:  Function lines", "[Parsing][Mixed]") {
+    constexpr std::string_view Source = R"(
+struct [[codegen::Dictionary(Lines)]] Parameters {
+    // value documentation
+    int value;
+
+    // other documentation
+    float other;
+};
+
+[[codegen::luawrap]] void foo() {
+    std::string s = "}";
+    if (true) {
+    }
+}
+
+enum class [[codegen::stringify()]] Enum {
+    A,
+    B
+};
+
+/*
+ * [[codegen::luawrap]] void commented() {}
+ */
+[[codegen::luawrap]] void bar(int a,
+                              int b)
+{
+}
+)";
+
+    Code code = parse(Source);
+    REQUIRE(code.luaWrapperFunctions.size() == 2);
+    Function* foo = code.luaWrapperFunctions[0];
+    REQUIRE(foo);
+    CHECK(foo->functionName == "foo");
+    CHECK(foo->sourceLocation.line == 10);
+
+    Function* bar = code.luaWrapperFunctions[1];
+    REQUIRE(bar);
+    CHECK(bar->functionName == "bar");
+    CHECK(bar->sourceLocation.line == 24);
+}
+
+TEST_CASE("Parsing/Mixed/Markers:  Unterminated struct", "[Parsing][Mixed]") {
+    constexpr std::string_view Source = R"(
+struct [[codegen::Dictionary(Unterminated)]] Parameters {
+    int value;
+    // }
+)";
+
+    CHECK_THROWS_MATCHES(
+        parse(Source),
+        CodegenError, CM::StartsWith("Could not find closing } of root struct")
+    );
+}
+
+TEST_CASE("Parsing/Mixed/Markers:  Unterminated enum", "[Parsing][Mixed]") {
+    constexpr std::string_view Source = R"(
+enum class [[codegen::stringify()]] Enum {
+    A,
+    B = '}'
+)";
+
+    CHECK_THROWS_MATCHES(
+        parse(Source),
+        CodegenError, CM::StartsWith("Could not find closing } of root enum")
+    );
+}
+
+TEST_CASE("Parsing/Mixed/Markers:  Unterminated function", "[Parsing][Mixed]") {
+    constexpr std::string_view Source = R"(
+[[codegen::luawrap]] void foo(std::string a = "{")
+)";
+
+    CHECK_THROWS_MATCHES(
+        parse(Source),
+        CodegenError, CM::StartsWith("Illformed function definition at")
+    );
+}
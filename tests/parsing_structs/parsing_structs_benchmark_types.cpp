@@ -0,0 +1,111 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "arena.h"
+#include "parsing.h"
+#include "types.h"
+#include <array>
+#include <string_view>
+
+// These benchmarks are hidden by default and have to be requested explicitly, for
+// example by running `codegentest [benchmark]`
+
+TEST_CASE("Parsing/Structs/Benchmark: Types", "[.][benchmark]") {
+    constexpr std::string_view Source = R"(
+    struct [[codegen::Dictionary(Benchmark)]] Parameters {
+        bool a1;
+        int a2;
+        double a3;
+        float a4;
+        std::string a5;
+        std::filesystem::path a6;
+        glm::ivec2 a7;
+        glm::ivec3 a8;
+        glm::ivec4 a9;
+        glm::dvec2 a10;
+        glm::dvec3 a11;
+        glm::dvec4 a12;
+        glm::vec2 a13;
+        glm::vec3 a14;
+        glm::vec4 a15;
+        glm::mat2x2 a16;
+        glm::mat2x3 a17;
+        glm::mat2x4 a18;
+        glm::mat3x2 a19;
+        glm::mat3x3 a20;
+        glm::mat3x4 a21;
+        glm::mat4x2 a22;
+        glm::mat4x3 a23;
+        glm::mat4x4 a24;
+        glm::dmat2x2 a25;
+        glm::dmat2x3 a26;
+        glm::dmat2x4 a27;
+        glm::dmat3x2 a28;
+        glm::dmat3x3 a29;
+        glm::dmat3x4 a30;
+        glm::dmat4x2 a31;
+        glm::dmat4x3 a32;
+        glm::dmat4x4 a33;
+        ghoul::Dictionary a34;
+        std::optional<glm::dmat4x4> b1;
+        std::optional<std::vector<glm::dvec3>> b2;
+        std::vector<std::optional<float>> b3;
+        std::map<std::string, glm::mat3x3> b4;
+        std::variant<bool, int, double, float, std::string, glm::dvec4> b5;
+        std::vector<std::variant<glm::ivec2, glm::dmat2x2, std::string>> b6;
+        std::optional<std::map<std::string, std::vector<glm::vec4>>> b7;
+        std::array<glm::dvec3, 4> b8;
+        std::tuple<int, glm::dvec2, std::string, double> b9;
+        std::optional<std::tuple<float, glm::ivec4, glm::mat4x2>> b10;
+    };
+)";
+
+    constexpr std::array<std::string_view, 12> Types = {
+        "bool", "std::string", "glm::dvec3", "glm::mat3", "glm::mat4x4", "glm::dmat2x3",
+        "glm::dmat3", "glm::dmat4x2", "glm::dmat4x4", "glm::dmat4", "ghoul::Dictionary",
+        "std::vector<glm::dmat4x3>"
+    };
+
+    const Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    REQUIRE(code.structs.front()->variables.size() == 44);
+
+    BENCHMARK("parseType") {
+        // A new arena for every run so that the memory doesn't grow over the runs and
+        // each run starts with the same allocations
+        Arena arena;
+        int nTypes = 0;
+        for (const std::string_view type : Types) {
+            nTypes += parseType(type, nullptr, arena) != nullptr;
+        }
+        return nTypes;
+    };
+
+    BENCHMARK("parse") {
+        return parse(Source).structs.size();
+    };
+}
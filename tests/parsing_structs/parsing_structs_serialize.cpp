@@ -0,0 +1,226 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace Codegen                                                                     *
+ *                                                                                       *
+ * Copyright (c) 2021-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_exception.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "codegen.h"
+#include "parsing.h"
+#include "types.h"
+#include <string>
+#include <string_view>
+
+namespace CM = Catch::Matchers;
+
+namespace {
+    // Returns the layout hash that was written into the serialize function of the struct
+    std::string serializationHash(const std::string& result, std::string_view name) {
+        const std::string marker =
+            "template <> [[maybe_unused]] void serialize<" + std::string(name) + ">";
+        const size_t p = result.find(marker);
+        if (p == std::string::npos) {
+            return "";
+        }
+        const size_t begin = result.find("platformHash(", p) + 13;
+        const size_t end = result.find("ULL", begin);
+        return result.substr(begin, end - begin);
+    }
+} // namespace
+
+TEST_CASE("Parsing/Structs/Serialize: Functions", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(
+struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+    enum class E {
+        A,
+        B
+    };
+    struct A {
+        std::optional<std::vector<int>> value;
+    };
+
+    int a;
+    std::map<std::string, A> b;
+    std::variant<float, std::string> c;
+    std::tuple<E, glm::dvec3> d;
+    std::array<std::filesystem::path, 2> e;
+};)";
+
+    Code code = parse(Source);
+    const std::string r = generateResult(code);
+    CHECK(r.find("serialize<Parameters>(const Parameters& value") != std::string::npos);
+    CHECK(
+        r.find("deserialize<Parameters>(std::span<const std::byte> data)") !=
+        std::string::npos
+    );
+    CHECK(r.find("const Parameters::A& value) {") != std::string::npos);
+    CHECK(r.find("const std::optional<T>& value) {") != std::string::npos);
+    CHECK(r.find("const std::vector<T>& value) {") != std::string::npos);
+    CHECK(r.find("const std::map<K, V>& value) {") != std::string::npos);
+    CHECK(r.find("const std::variant<Ts...>& value) {") != std::string::npos);
+    CHECK(r.find("const std::tuple<Ts...>& value) {") != std::string::npos);
+    CHECK(r.find("const std::array<T, N>& value) {") != std::string::npos);
+    CHECK(r.find("const std::filesystem::path& value) {") != std::string::npos);
+    CHECK(!serializationHash(r, "Parameters").empty());
+}
+
+TEST_CASE("Parsing/Structs/Serialize: Dictionary", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(
+struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+    struct A {
+        std::vector<ghoul::Dictionary> value;
+    };
+
+    int a;
+    A b;
+};)";
+
+    Code code = parse(Source);
+    CHECK_THROWS_MATCHES(
+        generateResult(code),
+        CodegenError,
+        CM::StartsWith(
+            "Struct 'Parameters' is marked with codegen::serialize, but contains a type "
+            "that can't be serialized"
+        )
+    );
+}
+
+TEST_CASE("Parsing/Structs/Serialize: Not requested", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(
+struct [[codegen::Dictionary(Name)]] Parameters {
+    int a;
+    std::vector<std::string> b;
+};)";
+
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    CHECK(!code.structs.front()->attributes.serialize);
+
+    const std::string r = generateResult(code);
+    CHECK(r.find("serialize<Parameters>") == std::string::npos);
+    CHECK(r.find("serializeTo") == std::string::npos);
+    CHECK(r.find("#include <cstring>") == std::string::npos);
+}
+
+TEST_CASE("Parsing/Structs/Serialize: Native types", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(
+struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+    enum class E {
+        A,
+        B
+    };
+
+    bool a;
+    std::string b;
+    std::vector<int> c;
+    std::optional<glm::dvec3> d;
+    std::map<std::string, E> e;
+    int f;
+};)";
+
+    Code code = parse(Source);
+    const std::string r = generateResult(code);
+
+    // The values of these types are copied as they are in memory, so their size is part
+    // of the hash that is computed when the generated code is compiled
+    CHECK(
+        r.find(
+            "{ sizeof(int), sizeof(glm::dvec3), sizeof(Parameters::E) }"
+        ) != std::string::npos
+    );
+    CHECK(r.find("sizeof(bool)") == std::string::npos);
+    CHECK(r.find("sizeof(std::string)") == std::string::npos);
+}
+
+TEST_CASE("Parsing/Structs/Serialize: Hash", "[Parsing][Structs]") {
+    auto hash = [](std::string_view source) {
+        Code code = parse(source);
+        return serializationHash(generateResult(code), "Parameters");
+    };
+
+    const std::string base = hash(R"(
+struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+    enum class E {
+        A,
+        B
+    };
+    int a;
+    std::vector<E> b;
+};)");
+    REQUIRE(!base.empty());
+
+    // Documentation and attributes don't change the layout
+    CHECK(
+        hash(R"(
+struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+    enum class E {
+        A,
+        B
+    };
+    // a documentation
+    int a [[codegen::greater(2)]];
+    std::vector<E> b;
+};)") == base
+    );
+
+    // Changing the type of a member
+    CHECK(
+        hash(R"(
+struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+    enum class E {
+        A,
+        B
+    };
+    double a;
+    std::vector<E> b;
+};)") != base
+    );
+
+    // Reordering the elements of an enum
+    CHECK(
+        hash(R"(
+struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+    enum class E {
+        B,
+        A
+    };
+    int a;
+    std::vector<E> b;
+};)") != base
+    );
+
+    // Reordering the members
+    CHECK(
+        hash(R"(
+struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+    enum class E {
+        A,
+        B
+    };
+    std::vector<E> b;
+    int a;
+};)") != base
+    );
+}
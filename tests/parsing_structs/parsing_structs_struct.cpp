@@ -115,6 +115,150 @@ TEST_CASE("Parsing/Structs/Struct:  NoExhaustive false parameter", "[Parsing][St
     CHECK(!r.empty());
 }
 
+TEST_CASE("Parsing/Structs/Struct:  FusedBake no parameter", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(struct [[codegen::Dictionary(Name), codegen::fusedbake()]] Parameters {
+};)";
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+
+    REQUIRE(s);
+    CHECK(s->name == "Parameters");
+    CHECK(s->attributes.dictionary == "Name");
+    CHECK(s->attributes.fusedBake);
+    CHECK(s->variables.empty());
+
+    const std::string r = generateResult(code);
+    CHECK(!r.empty());
+}
+
+TEST_CASE("Parsing/Structs/Struct:  FusedBake true parameter", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(struct [[codegen::Dictionary(Name), codegen::fusedbake(true)]] Parameters {
+};)";
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+
+    REQUIRE(s);
+    CHECK(s->name == "Parameters");
+    CHECK(s->attributes.dictionary == "Name");
+    CHECK(s->attributes.fusedBake);
+    CHECK(s->variables.empty());
+
+    const std::string r = generateResult(code);
+    CHECK(!r.empty());
+}
+
+TEST_CASE("Parsing/Structs/Struct:  FusedBake false parameter", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(struct [[codegen::Dictionary(Name), codegen::fusedbake(false)]] Parameters {
+};)";
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+
+    REQUIRE(s);
+    CHECK(s->name == "Parameters");
+    CHECK(s->attributes.dictionary == "Name");
+    CHECK(!s->attributes.fusedBake);
+    CHECK(s->variables.empty());
+
+    const std::string r = generateResult(code);
+    CHECK(!r.empty());
+}
+
+TEST_CASE("Parsing/Structs/Struct:  FusedBake variables", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(
+struct [[codegen::Dictionary(Name), codegen::fusedbake()]] Parameters {
+    // a documentation
+    int a [[codegen::inrange(1, 5)]];
+    // b documentation
+    std::optional<std::string> b [[codegen::inlist("x", "y")]];
+    // c documentation
+    float c [[codegen::less(1.0)]];
+    // d documentation
+    std::vector<int> d;
+};)";
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+    REQUIRE(s);
+    CHECK(s->attributes.fusedBake);
+    REQUIRE(s->variables.size() == 4);
+
+    const std::string r = generateResult(code);
+    CHECK(
+        r.find(
+            "internal::fusedBakeTo(dict, \"A\", &res.a, "
+            "[](const auto& v) { return internal::inRange<int>(v, 1, 5); })"
+        ) != std::string::npos
+    );
+    CHECK(
+        r.find(
+            "internal::fusedBakeTo(dict, \"B\", &res.b, "
+            "[](const auto& v) { return internal::inList(v, { \"x\", \"y\" }); })"
+        ) != std::string::npos
+    );
+    CHECK(
+        r.find(
+            "internal::verifiedBakeTo(dict, \"C\", &res.c, *Doc.entries[2].verifier)"
+        ) != std::string::npos
+    );
+    CHECK(
+        r.find(
+            "internal::verifiedBakeTo(dict, \"D\", &res.d, *Doc.entries[3].verifier)"
+        ) != std::string::npos
+    );
+}
+
+TEST_CASE("Parsing/Structs/Struct:  BakeMany", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(struct [[codegen::Dictionary(Name), codegen::bakemany()]] Parameters {
+};)";
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+
+    REQUIRE(s);
+    CHECK(s->name == "Parameters");
+    CHECK(s->attributes.dictionary == "Name");
+    CHECK(s->attributes.bakeMany);
+
+    const std::string r = generateResult(code);
+    CHECK(r.find("#include <execution>") != std::string::npos);
+    CHECK(r.find("struct BakeManyError") != std::string::npos);
+}
+
+TEST_CASE("Parsing/Structs/Struct:  No BakeMany", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(struct [[codegen::Dictionary(Name)]] Parameters {
+};)";
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+
+    REQUIRE(s);
+    CHECK(!s->attributes.bakeMany);
+
+    const std::string r = generateResult(code);
+    CHECK(r.find("#include <execution>") == std::string::npos);
+    CHECK(r.find("struct BakeManyError") == std::string::npos);
+}
+
+TEST_CASE("Parsing/Structs/Struct:  Serialize", "[Parsing][Structs]") {
+    constexpr std::string_view Source = R"(struct [[codegen::Dictionary(Name), codegen::serialize()]] Parameters {
+};)";
+    Code code = parse(Source);
+    REQUIRE(code.structs.size() == 1);
+    Struct* s = code.structs.front();
+
+    REQUIRE(s);
+    CHECK(s->name == "Parameters");
+    CHECK(s->attributes.dictionary == "Name");
+    CHECK(s->attributes.serialize);
+
+    const std::string r = generateResult(code);
+    CHECK(r.find("#include <cstring>") != std::string::npos);
+    CHECK(r.find("serialize<Parameters>") != std::string::npos);
+}
+
 TEST_CASE("Parsing/Structs/Struct:  Substruct", "[Parsing][Structs]") {
     constexpr std::string_view Source = R"(struct [[codegen::Dictionary(Name)]] Parameters {
 struct A {